@@ -170,6 +170,7 @@ Seeker::Verb Seeker::_remove(
 Seeker::Verb Seeker::_foreach(
   TiObject *self, TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags
 ) {
+  Main::TimeReport::Scope timeScope(Main::TimeReport::Phase::SEEKING);
   PREPARE_SELF(seeker, Seeker);
   if (ref->isA<Ast::Identifier>()) {
     return seeker->foreachByIdentifier(static_cast<Ast::Identifier const*>(ref), target, cb, flags);
@@ -0,0 +1,198 @@
+/**
+ * @file Core/Main/Profiler.cpp
+ * Contains the implementation of class Core::Main::Profiler.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <signal.h>
+#include <sys/time.h>
+#include <execinfo.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <algorithm>
+
+namespace Core::Main
+{
+
+//==============================================================================
+// Helper Functions
+
+void Profiler::handleSignal(int signal)
+{
+  Int savedErrno = errno;
+  // The first two frames are this handler and the signal trampoline, so the third one is the interrupted code.
+  void *frames[Profiler::MAX_DEPTH + 2];
+  Int depth = backtrace(frames, Profiler::MAX_DEPTH + 2);
+  if (depth > 2) Profiler::getSingleton()->recordSample(frames + 2, depth - 2);
+  errno = savedErrno;
+}
+
+
+void Profiler::recordSample(void **frames, Int depth)
+{
+  // This is called from the signal handler, possibly on multiple threads at once, so space is reserved atomically and
+  // no allocations are made.
+  if (this->samplesEnd.load(std::memory_order_relaxed) >= Profiler::BUFFER_SIZE) {
+    this->droppedSampleCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Word start = this->samplesEnd.fetch_add(depth + 1, std::memory_order_relaxed);
+  if (start + depth + 1 > Profiler::BUFFER_SIZE) {
+    this->droppedSampleCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  for (Int i = 0; i < depth; ++i) this->samples[start + 1 + i] = (PtrWord)frames[i];
+  // The count is written last since a zero count marks the end of the recorded samples.
+  this->samples[start] = depth;
+}
+
+
+std::string Profiler::getFrameName(PtrWord address)
+{
+  // JIT compiled code.
+  auto it = this->symbols.upper_bound(address);
+  if (it != this->symbols.begin()) {
+    --it;
+    if (address < it->first + it->second.size) {
+      auto location = this->symbolLocations.find(it->second.name);
+      if (location == this->symbolLocations.end()) return it->second.name;
+      return it->second.name + S(" ") + location->second;
+    }
+  }
+
+  // Native code.
+  Dl_info info;
+  if (dladdr((void*)address, &info) == 0) return S("[unknown]");
+  if (info.dli_sname != 0) {
+    int status;
+    Char *demangled = abi::__cxa_demangle(info.dli_sname, 0, 0, &status);
+    if (demangled == 0) return info.dli_sname;
+    std::string name = demangled;
+    free(demangled);
+    return name;
+  }
+  if (info.dli_fname == 0) return S("[unknown]");
+  Char const *basename = strrchr(info.dli_fname, C('/'));
+  return std::string(S("[")) + (basename == 0 ? info.dli_fname : basename + 1) + S("]");
+}
+
+
+//==============================================================================
+// Profiling Functions
+
+void Profiler::enable(Char const *filename, Int frequency)
+{
+  if (this->enabled) return;
+  this->filename = filename;
+  this->samples.reset(new PtrWord[Profiler::BUFFER_SIZE]);
+  memset(this->samples.get(), 0, Profiler::BUFFER_SIZE * sizeof(PtrWord));
+  this->samplesEnd = 0;
+  this->droppedSampleCount = 0;
+
+  // The first call to backtrace loads the unwinder, which isn't safe to do inside a signal handler.
+  void *frames[1];
+  backtrace(frames, 1);
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = &Profiler::handleSignal;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGPROF, &action, 0);
+
+  itimerval timer;
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = 1000000 / frequency;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, 0);
+
+  this->enabled = true;
+}
+
+
+void Profiler::addSymbol(PtrWord address, PtrWord size, Char const *name)
+{
+  std::lock_guard<std::mutex> lock(this->symbolMutex);
+  auto &symbol = this->symbols[address];
+  symbol.size = size;
+  symbol.name = name;
+  // The folded stacks format uses semicolons to separate the frames.
+  std::replace(symbol.name.begin(), symbol.name.end(), C(';'), C(','));
+}
+
+
+void Profiler::setSymbolLocation(Char const *name, Char const *filename, Int line)
+{
+  std::lock_guard<std::mutex> lock(this->symbolMutex);
+  this->symbolLocations[name] = std::string(S("(")) + filename + S(":") + std::to_string(line) + S(")");
+}
+
+
+Bool Profiler::writeReport()
+{
+  if (!this->enabled) return true;
+  this->enabled = false;
+
+  itimerval timer;
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, 0);
+  signal(SIGPROF, SIG_IGN);
+
+  std::lock_guard<std::mutex> lock(this->symbolMutex);
+
+  // Aggregate identical stacks, which are keyed by their folded form.
+  std::unordered_map<PtrWord, std::string> frameNames;
+  std::map<std::string, Word> stacks;
+  Word end = std::min(this->samplesEnd.load(), Profiler::BUFFER_SIZE);
+  for (Word i = 0; i < end && this->samples[i] != 0; i += this->samples[i] + 1) {
+    Int depth = this->samples[i];
+    std::string stack;
+    for (Int j = depth - 1; j >= 0; --j) {
+      // Return addresses point after the call instruction, so we step back into it, except for the innermost frame
+      // which points to the interrupted instruction itself.
+      PtrWord address = this->samples[i + 1 + j];
+      if (j > 0) --address;
+      auto nameIt = frameNames.find(address);
+      if (nameIt == frameNames.end()) nameIt = frameNames.insert({ address, this->getFrameName(address) }).first;
+      if (!stack.empty()) stack += ';';
+      stack += nameIt->second;
+    }
+    ++stacks[stack];
+  }
+
+  std::ofstream file(this->filename.getBuf());
+  if (!file.is_open()) return false;
+  for (auto const &stack : stacks) {
+    file << stack.first << ' ' << stack.second << '\n';
+  }
+  if (this->droppedSampleCount > 0) {
+    file << S("[dropped] ") << this->droppedSampleCount.load() << '\n';
+  }
+  return true;
+}
+
+
+//==============================================================================
+// Singleton
+
+Profiler* Profiler::getSingleton()
+{
+  static Profiler *profiler = 0;
+  if (profiler == 0) {
+    profiler = reinterpret_cast<Profiler*>(GLOBAL_STORAGE->getObject(S("Core::Main::Profiler")));
+    if (profiler == 0) {
+      profiler = new Profiler;
+      GLOBAL_STORAGE->setObject(S("Core::Main::Profiler"), reinterpret_cast<void*>(profiler));
+    }
+  }
+  return profiler;
+}
+
+} // namespace
@@ -0,0 +1,126 @@
+/**
+ * @file Core/Main/Profiler.h
+ * Contains the header of class Core::Main::Profiler.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_MAIN_PROFILER_H
+#define CORE_MAIN_PROFILER_H
+
+namespace Core::Main
+{
+
+/**
+ * @brief A sampling profiler for the executed program.
+ * @ingroup core_standard
+ *
+ * Samples the call stacks of all threads at a fixed rate of CPU time using
+ * SIGPROF and writes them at the end in the folded stacks format used by
+ * flame graph tools, i.e. one line per unique stack with the frames separated
+ * by semicolons starting from the root and followed by the number of samples.
+ * Frames in JIT compiled code are named using the symbols registered by the
+ * code generator, along with the source locations of their functions, while
+ * frames in native code are named using the dynamic symbol tables.
+ */
+class Profiler
+{
+  //============================================================================
+  // Types
+
+  private: struct Symbol
+  {
+    PtrWord size;
+    std::string name;
+  };
+
+
+  //============================================================================
+  // Constants
+
+  /// The maximum number of frames recorded per sample.
+  public: static constexpr Int MAX_DEPTH = 128;
+
+  /// The size of the sample buffer in words. Samples are dropped once it's full.
+  public: static constexpr Word BUFFER_SIZE = 4 * 1024 * 1024;
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Bool enabled = false;
+  private: Str filename;
+
+  private: std::mutex symbolMutex;
+  private: std::map<PtrWord, Symbol> symbols;
+  private: std::unordered_map<std::string, std::string> symbolLocations;
+
+  // Each sample is stored as a frame count followed by the frames, starting from the innermost one.
+  private: std::unique_ptr<PtrWord[]> samples;
+  private: std::atomic<Word> samplesEnd = 0;
+  private: std::atomic<Word> droppedSampleCount = 0;
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: Profiler()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Helper Functions
+  /// @{
+
+  private: static void handleSignal(int signal);
+
+  private: void recordSample(void **frames, Int depth);
+
+  private: std::string getFrameName(PtrWord address);
+
+  /// @}
+
+  /// @name Profiling Functions
+  /// @{
+
+  /// Start sampling at the given frequency (in samples per second of CPU time).
+  public: void enable(Char const *filename, Int frequency = 1000);
+
+  public: Bool isEnabled() const
+  {
+    return this->enabled;
+  }
+
+  /// Registers a symbol of JIT compiled code. Can be called from any thread.
+  public: void addSymbol(PtrWord address, PtrWord size, Char const *name);
+
+  /// Sets the source location to be shown for the symbol with the given name.
+  public: void setSymbolLocation(Char const *name, Char const *filename, Int line);
+
+  /// Stop sampling and write the folded stacks into the file given to enable().
+  public: Bool writeReport();
+
+  public: Str const& getFilename() const
+  {
+    return this->filename;
+  }
+
+  /// @}
+
+  /// Get the singleton object.
+  public: static Profiler* getSingleton();
+
+}; // class
+
+} // namespace
+
+#endif
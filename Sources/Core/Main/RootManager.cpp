@@ -46,6 +46,8 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   factory.createGrammar(this->exprRootScope.get(), this, true);
 
   this->interactive = false;
+  this->batchExecution = false;
+  this->publishingJitSymbols = false;
   this->processArgCount = 0;
   this->processArgs = 0;
 
@@ -96,6 +98,7 @@ SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 
 SharedPtr<TiObject> RootManager::processString(Char const *str, Char const *name)
 {
+  TimeReport::FileScope fileScope(name);
   Processing::Engine engine(this->rootScope);
   this->noticeSignal.relay(engine.noticeSignal);
   return engine.processString(str, name);
@@ -154,6 +157,8 @@ SharedPtr<TiObject> RootManager::processStream(Processing::CharInStreaming *is,
 
 Bool RootManager::tryImportFile(Char const *filename, Str &errorDetails)
 {
+  TimeReport::Scope timeScope(TimeReport::Phase::IMPORTING);
+
   // Lookup the file in the search paths.
   Bool loadSource = false;
   thread_local static std::array<Char,PATH_MAX> resultFilename;
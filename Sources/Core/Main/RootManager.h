@@ -55,6 +55,8 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
   private: Int minNoticeSeverityEncountered = -1;
 
   private: Bool interactive;
+  private: Bool batchExecution;
+  private: Bool publishingJitSymbols;
   private: Int processArgCount;
   private: Char const *const *processArgs;
   private: Str language;
@@ -157,6 +159,40 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->interactive;
   }
 
+  /**
+   * @brief Set whether root statements should be executed in batches.
+   * When enabled, consecutive root statements are accumulated and executed
+   * together at the end of the source or before the next import, rather
+   * than individually as they get parsed. A build error in any statement of
+   * a batch prevents the entire batch from executing. This is ignored in
+   * interactive mode.
+   */
+  public: void setBatchExecution(Bool b)
+  {
+    this->batchExecution = b;
+  }
+
+  public: Bool isBatchExecution() const
+  {
+    return this->batchExecution;
+  }
+
+  /**
+   * @brief Set whether the symbols of JIT compiled code should be published.
+   * When enabled, the names and addresses of JIT compiled functions are
+   * written to /tmp/perf-<pid>.map for perf and registered with GDB's JIT
+   * interface.
+   */
+  public: void setPublishingJitSymbols(Bool p)
+  {
+    this->publishingJitSymbols = p;
+  }
+
+  public: Bool isPublishingJitSymbols() const
+  {
+    return this->publishingJitSymbols;
+  }
+
   public: void setProcessArgInfo(Int count, Char const *const *args)
   {
     this->processArgCount = count;
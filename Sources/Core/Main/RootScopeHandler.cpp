@@ -21,7 +21,8 @@ namespace Core::Main
 void RootScopeHandler::initBindingCaches()
 {
   Basic::initBindingCaches(this, {
-    &this->addNewElement
+    &this->addNewElement,
+    &this->flushPendingElements
   });
 }
 
@@ -29,6 +30,7 @@ void RootScopeHandler::initBindingCaches()
 void RootScopeHandler::initBindings()
 {
   this->addNewElement = &RootScopeHandler::_addNewElement;
+  this->flushPendingElements = &RootScopeHandler::_flushPendingElements;
 }
 
 
@@ -46,4 +48,10 @@ void RootScopeHandler::_addNewElement(TiObject *self, TioSharedPtr const &data,
   }
 }
 
+
+void RootScopeHandler::_flushPendingElements(
+  TiObject *self, Processing::Parser *parser, Processing::ParserState *state
+) {
+}
+
 } // namespace
@@ -97,6 +97,20 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
     Core::Processing::Parser *parser, Processing::ParserState *state
   );
 
+  /**
+   * @brief Finalize any root elements whose processing was deferred.
+   * This is called at the end of each processed source and before imports,
+   * giving extensions that defer the processing of new root elements a chance
+   * to complete that processing while the parser state is still valid. The
+   * default implementation does nothing.
+   */
+  public: METHOD_BINDING_CACHE(flushPendingElements,
+    void, (Processing::Parser* /* parser */, Processing::ParserState* /* state */)
+  );
+  private: static void _flushPendingElements(
+    TiObject *self, Core::Processing::Parser *parser, Processing::ParserState *state
+  );
+
   /// @}
 
 }; // class
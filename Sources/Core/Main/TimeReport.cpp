@@ -0,0 +1,246 @@
+/**
+ * @file Core/Main/TimeReport.cpp
+ * Contains the implementation of class Core::Main::TimeReport.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <time.h>
+#include <sys/resource.h>
+
+namespace Core::Main
+{
+
+//==============================================================================
+// Helper Functions
+
+static Word getClockNs(clockid_t clock)
+{
+  timespec ts;
+  clock_gettime(clock, &ts);
+  return (Word)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+void TimeReport::charge(Bool updatePeakRss)
+{
+  Word wallTime = getClockNs(CLOCK_MONOTONIC);
+  Word cpuTime = getClockNs(CLOCK_PROCESS_CPUTIME_ID);
+  Word allocationCount = this->allocationCount.load(std::memory_order_relaxed);
+
+  if (this->phaseStack.size() > 0) {
+    Int file = this->fileStack.size() > 0 ? this->fileStack.back() : 0;
+    auto &stats = this->stats[file][this->phaseStack.back()];
+    stats.wallTime += wallTime - this->lastWallTime;
+    stats.cpuTime += cpuTime - this->lastCpuTime;
+    stats.allocations += allocationCount - this->lastAllocationCount;
+    if (updatePeakRss) {
+      rusage usage;
+      getrusage(RUSAGE_SELF, &usage);
+      if ((Word)usage.ru_maxrss > stats.peakRss) stats.peakRss = usage.ru_maxrss;
+    }
+  }
+
+  this->lastWallTime = wallTime;
+  this->lastCpuTime = cpuTime;
+  this->lastAllocationCount = allocationCount;
+}
+
+
+Char const* TimeReport::getPhaseName(Int phase)
+{
+  switch (phase) {
+    case Phase::LEXING: return S("lexing");
+    case Phase::PARSING: return S("parsing");
+    case Phase::IMPORTING: return S("importResolution");
+    case Phase::MACRO_PROCESSING: return S("macroProcessing");
+    case Phase::SEEKING: return S("semanticLookups");
+    case Phase::IR_GENERATION: return S("irGeneration");
+    case Phase::OPTIMIZATION: return S("llvmOptimization");
+    case Phase::EMISSION: return S("machineCodeEmission");
+    case Phase::LINKING: return S("linking");
+    case Phase::EXECUTION: return S("execution");
+    default: return S("unknown");
+  }
+}
+
+
+//==============================================================================
+// Tracking Functions
+
+void TimeReport::enable()
+{
+  this->enabled = true;
+  this->threadId = std::this_thread::get_id();
+  if (this->files.size() == 0) {
+    // Work done outside of any file is charged to an unnamed entry.
+    this->files.push_back(Str(S("")));
+    this->stats.emplace_back();
+  }
+  this->charge(false);
+}
+
+
+void TimeReport::enterPhase(Int phase)
+{
+  this->charge(false);
+  this->phaseStack.push_back(phase);
+}
+
+
+void TimeReport::exitPhase()
+{
+  this->charge(true);
+  this->phaseStack.pop_back();
+}
+
+
+void TimeReport::enterFile(Char const *filename)
+{
+  this->charge(false);
+  Int index = -1;
+  for (Int i = 0; i < this->files.size(); ++i) {
+    if (this->files[i] == filename) {
+      index = i;
+      break;
+    }
+  }
+  if (index == -1) {
+    index = this->files.size();
+    this->files.push_back(Str(filename));
+    this->stats.emplace_back();
+  }
+  this->fileStack.push_back(index);
+}
+
+
+void TimeReport::exitFile()
+{
+  this->charge(false);
+  this->fileStack.pop_back();
+}
+
+
+//==============================================================================
+// Reporting Functions
+
+void TimeReport::print(OutStream &stream)
+{
+  this->charge(true);
+
+  Char line[256];
+  std::array<Stats, Phase::COUNT> totals;
+  for (Int i = 0; i < this->stats.size(); ++i) {
+    for (Int j = 0; j < Phase::COUNT; ++j) {
+      totals[j].wallTime += this->stats[i][j].wallTime;
+      totals[j].cpuTime += this->stats[i][j].cpuTime;
+      totals[j].allocations += this->stats[i][j].allocations;
+      if (this->stats[i][j].peakRss > totals[j].peakRss) totals[j].peakRss = this->stats[i][j].peakRss;
+    }
+  }
+
+  stream << S("\n===== Time Report =====\n\n");
+  snprintf(
+    line, sizeof(line), "%-24s %12s %12s %14s %16s\n", "Phase", "Wall (ms)", "CPU (ms)", "Allocations",
+    "Peak RSS (KB)"
+  );
+  stream << line;
+  Stats sum;
+  for (Int j = 0; j < Phase::COUNT; ++j) {
+    snprintf(
+      line, sizeof(line), "%-24s %12.3f %12.3f %14lu %16lu\n", TimeReport::getPhaseName(j),
+      totals[j].wallTime / 1000000.0, totals[j].cpuTime / 1000000.0, (unsigned long)totals[j].allocations,
+      (unsigned long)totals[j].peakRss
+    );
+    stream << line;
+    sum.wallTime += totals[j].wallTime;
+    sum.cpuTime += totals[j].cpuTime;
+    sum.allocations += totals[j].allocations;
+    if (totals[j].peakRss > sum.peakRss) sum.peakRss = totals[j].peakRss;
+  }
+  snprintf(
+    line, sizeof(line), "%-24s %12.3f %12.3f %14lu %16lu\n", "total", sum.wallTime / 1000000.0,
+    sum.cpuTime / 1000000.0, (unsigned long)sum.allocations, (unsigned long)sum.peakRss
+  );
+  stream << line;
+
+  stream << S("\nPer File:\n");
+  for (Int i = 0; i < this->files.size(); ++i) {
+    Word fileWallTime = 0;
+    for (Int j = 0; j < Phase::COUNT; ++j) fileWallTime += this->stats[i][j].wallTime;
+    if (fileWallTime == 0) continue;
+    snprintf(
+      line, sizeof(line), "\n%s (%.3f ms)\n", i == 0 ? "<none>" : this->files[i].getBuf(), fileWallTime / 1000000.0
+    );
+    stream << line;
+    for (Int j = 0; j < Phase::COUNT; ++j) {
+      auto &phaseStats = this->stats[i][j];
+      if (phaseStats.wallTime == 0) continue;
+      snprintf(
+        line, sizeof(line), "  %-22s %12.3f %12.3f %14lu\n", TimeReport::getPhaseName(j),
+        phaseStats.wallTime / 1000000.0, phaseStats.cpuTime / 1000000.0, (unsigned long)phaseStats.allocations
+      );
+      stream << line;
+    }
+  }
+}
+
+
+void TimeReport::printJson(OutStream &stream)
+{
+  this->charge(true);
+
+  auto printStats = [&stream](Stats const &phaseStats) {
+    Char buf[200];
+    snprintf(
+      buf, sizeof(buf), "\"wallMs\": %.3f, \"cpuMs\": %.3f, \"allocations\": %lu, \"peakRssKb\": %lu",
+      phaseStats.wallTime / 1000000.0, phaseStats.cpuTime / 1000000.0, (unsigned long)phaseStats.allocations,
+      (unsigned long)phaseStats.peakRss
+    );
+    stream << buf;
+  };
+
+  stream << S("{\n  \"files\": [");
+  for (Int i = 0; i < this->files.size(); ++i) {
+    if (i > 0) stream << S(",");
+    stream << S("\n    {\n      \"name\": \"");
+    for (Char const *c = this->files[i].getBuf(); *c != 0; ++c) {
+      if (*c == C('"') || *c == C('\\')) stream << C('\\');
+      stream << *c;
+    }
+    stream << S("\",\n      \"phases\": {");
+    for (Int j = 0; j < Phase::COUNT; ++j) {
+      if (j > 0) stream << S(",");
+      stream << S("\n        \"") << TimeReport::getPhaseName(j) << S("\": { ");
+      printStats(this->stats[i][j]);
+      stream << S(" }");
+    }
+    stream << S("\n      }\n    }");
+  }
+  stream << S("\n  ]\n}\n");
+}
+
+
+//==============================================================================
+// Singleton
+
+TimeReport* TimeReport::getSingleton()
+{
+  static TimeReport *timeReport = 0;
+  if (timeReport == 0) {
+    timeReport = reinterpret_cast<TimeReport*>(GLOBAL_STORAGE->getObject(S("Core::Main::TimeReport")));
+    if (timeReport == 0) {
+      timeReport = new TimeReport;
+      GLOBAL_STORAGE->setObject(S("Core::Main::TimeReport"), reinterpret_cast<void*>(timeReport));
+    }
+  }
+  return timeReport;
+}
+
+} // namespace
@@ -0,0 +1,166 @@
+/**
+ * @file Core/Main/TimeReport.h
+ * Contains the header of class Core::Main::TimeReport.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_MAIN_TIMEREPORT_H
+#define CORE_MAIN_TIMEREPORT_H
+
+namespace Core::Main
+{
+
+/**
+ * @brief Collects the time and memory spent in each phase of the build.
+ * @ingroup core_standard
+ *
+ * Phases are entered and exited in a stack like manner and the time spent in
+ * a nested phase is charged to that phase only rather than to its parent as
+ * well. Statistics are also broken down by the source file being processed
+ * at the time. Only the thread that enabled the report is tracked; work done
+ * on other threads is charged to the phase that is active on the main thread
+ * in terms of CPU time.
+ */
+class TimeReport
+{
+  //============================================================================
+  // Types
+
+  public: s_enum(Phase,
+    LEXING, PARSING, IMPORTING, MACRO_PROCESSING, SEEKING, IR_GENERATION, OPTIMIZATION, EMISSION, LINKING,
+    EXECUTION, COUNT
+  );
+
+  public: struct Stats
+  {
+    Word wallTime = 0;
+    Word cpuTime = 0;
+    Word allocations = 0;
+    Word peakRss = 0;
+  };
+
+  /// Enters a phase upon construction and exits it upon destruction.
+  public: class Scope
+  {
+    private: TimeReport *report;
+
+    public: Scope(Phase::_Phase phase) : report(TimeReport::getSingleton())
+    {
+      if (this->report->isEnabled()) this->report->enterPhase(phase);
+      else this->report = 0;
+    }
+
+    public: ~Scope()
+    {
+      if (this->report != 0) this->report->exitPhase();
+    }
+  };
+
+  /// Enters a file upon construction and exits it upon destruction.
+  public: class FileScope
+  {
+    private: TimeReport *report;
+
+    public: FileScope(Char const *filename) : report(TimeReport::getSingleton())
+    {
+      if (this->report->isEnabled()) this->report->enterFile(filename);
+      else this->report = 0;
+    }
+
+    public: ~FileScope()
+    {
+      if (this->report != 0) this->report->exitFile();
+    }
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Bool enabled = false;
+  private: std::thread::id threadId;
+  private: std::atomic<Word> allocationCount = 0;
+
+  private: std::vector<Str> files;
+  private: std::vector<std::array<Stats, Phase::COUNT>> stats;
+  private: std::vector<Int> phaseStack;
+  private: std::vector<Int> fileStack;
+
+  private: Word lastWallTime = 0;
+  private: Word lastCpuTime = 0;
+  private: Word lastAllocationCount = 0;
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: TimeReport()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Helper Functions
+  /// @{
+
+  private: void charge(Bool updatePeakRss);
+
+  private: static Char const* getPhaseName(Int phase);
+
+  /// @}
+
+  /// @name Tracking Functions
+  /// @{
+
+  /// Start tracking on the calling thread.
+  public: void enable();
+
+  public: Bool isEnabled() const
+  {
+    return this->enabled && this->threadId == std::this_thread::get_id();
+  }
+
+  public: void enterPhase(Int phase);
+
+  public: void exitPhase();
+
+  public: void enterFile(Char const *filename);
+
+  public: void exitFile();
+
+  /// Called by the allocation functions to count allocations.
+  public: void countAllocation()
+  {
+    this->allocationCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// @}
+
+  /// @name Reporting Functions
+  /// @{
+
+  /// Print the report in a human readable table.
+  public: void print(OutStream &stream);
+
+  /// Print the report in JSON format.
+  public: void printJson(OutStream &stream);
+
+  /// @}
+
+  /// Get the singleton object.
+  public: static TimeReport* getSingleton();
+
+}; // class
+
+} // namespace
+
+#endif
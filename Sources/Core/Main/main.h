@@ -93,6 +93,8 @@ Srl::String getModuleDirectory();
 //==============================================================================
 // Classes
 
+#include "TimeReport.h"
+#include "Profiler.h"
 #include "LibraryGateway.h"
 #include "LibraryManager.h"
 #include "RootScopeHandler.h"
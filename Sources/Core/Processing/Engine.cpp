@@ -37,6 +37,8 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
     throw EXCEPTION(InvalidArgumentException, S("str"), S("Cannot be null."), str);
   }
 
+  Main::TimeReport::Scope timeScope(Main::TimeReport::Phase::LEXING);
+
   this->parser.beginParsing();
 
   // Start passing characters to the lexer.
@@ -79,6 +81,9 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
     throw EXCEPTION(InvalidArgumentException, S("is"), S("Cannot be null."));
   }
 
+  Main::TimeReport::FileScope fileScope(streamName);
+  Main::TimeReport::Scope timeScope(Main::TimeReport::Phase::LEXING);
+
   parser.beginParsing();
 
   // Start passing characters to the lexer.
@@ -23,6 +23,9 @@ using namespace Data;
 
 void ImportParsingHandler::onProdEnd(Parser *parser, ParserState *state)
 {
+  // Complete the processing of preceding statements first since the imported file may depend on their results.
+  this->rootManager->getRootScopeHandler()->flushPendingElements(parser, state);
+
   Str filenames;
   Str errorDetails;
   auto result = this->tryImport(
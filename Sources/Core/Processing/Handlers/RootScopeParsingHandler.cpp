@@ -21,6 +21,13 @@ void RootScopeParsingHandler::onProdStart(Parser *parser, ParserState *state, Da
 }
 
 
+void RootScopeParsingHandler::onProdEnd(Parser *parser, ParserState *state)
+{
+  // Give the root scope handler a chance to complete any deferred processing before the parser state is cleared.
+  this->rootScopeHandler->flushPendingElements(parser, state);
+}
+
+
 void RootScopeParsingHandler::addData(
   SharedPtr<TiObject> const &data, Parser *parser, ParserState *state, Int levelIndex
 ) {
@@ -146,6 +146,8 @@ SharedPtr<TiObject> Parser::endParsing(Data::SourceLocationRecord &endSourceLoca
     throw EXCEPTION(GenericException, S("Parsing is not initialized yet."));
   }
 
+  Main::TimeReport::Scope timeScope(Main::TimeReport::Phase::PARSING);
+
 // Fold out the levels stack of existing states.
   this->tryCompleteFoldout(this->state.get());
   this->reportMislocatedLeadingModifiers(this->state.get());
@@ -271,6 +273,8 @@ void Parser::handleNewToken(Data::Token const *token)
     throw EXCEPTION(InvalidArgumentException, S("token"), S("token is null."));
   }
 
+  Main::TimeReport::Scope timeScope(Main::TimeReport::Phase::PARSING);
+
   // The caller should call beginParsing before calling handleNewToken, and should not call handleNewToken
   // after parsing folds out of the production tree.
   if (this->state->getTermLevelCount() == 0)
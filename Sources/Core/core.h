@@ -17,6 +17,7 @@
 #include <vector>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <string>
 #include <iostream>
@@ -24,6 +25,9 @@
 #include <string.h>
 #include <type_traits>
 #include <atomic>
+#include <thread>
+#include <mutex>
+#include <map>
 #include <functional>
 #include <limits.h>
 
@@ -13,6 +13,7 @@
 #include "core.h"
 #include <stdlib.h>
 #include <string.h>
+#include <new>
 
 /**
  * @defgroup main Main
@@ -22,6 +23,33 @@
 using namespace Core;
 
 
+/**
+ * @brief The time report to count allocations for, if enabled.
+ * @ingroup main
+ */
+static Main::TimeReport *allocationTimeReport = 0;
+
+/**
+ * @brief Replacement of the global allocation function to count allocations.
+ * @ingroup main
+ * Allocations are only counted when the time report is enabled. The rest of
+ * the allocation functions rely on this one, so allocations of arrays are
+ * counted as well.
+ */
+void* operator new(std::size_t size)
+{
+  if (allocationTimeReport != 0) allocationTimeReport->countAllocation();
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == 0) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+
 /**
  * @brief Get the system language code from env vars.
  * @ingroup main
@@ -52,6 +80,11 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Bool batch = false;
+  Bool timeReport = false;
+  Bool timeReportJson = false;
+  Bool jitSymbols = false;
+  Char const *profileFilename = 0;
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
     if (strcmp(args[i], S("--help")) == 0) help = true;
@@ -62,6 +95,20 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    else if (strcmp(args[i], S("--batch")) == 0) batch = true;
+    else if (strcmp(args[i], S("--دفعي")) == 0) batch = true;
+    else if (strcmp(args[i], S("--time-report")) == 0) timeReport = true;
+    else if (strcmp(args[i], S("--تقرير-الوقت")) == 0) timeReport = true;
+    else if (strcmp(args[i], S("--time-report=json")) == 0) timeReport = timeReportJson = true;
+    else if (strcmp(args[i], S("--تقرير-الوقت=json")) == 0) timeReport = timeReportJson = true;
+    else if (strcmp(args[i], S("--jit-symbols")) == 0) jitSymbols = true;
+    else if (strcmp(args[i], S("--رموز-التنفيذ")) == 0) jitSymbols = true;
+    else if (strcmp(args[i], S("--profile")) == 0) profileFilename = S("profile.folded");
+    else if (strcmp(args[i], S("--تحليل-الأداء")) == 0) profileFilename = S("profile.folded");
+    else if (strncmp(args[i], S("--profile="), 10) == 0) profileFilename = args[i] + 10;
+    else if (strncmp(args[i], S("--تحليل-الأداء="), getStrLen(S("--تحليل-الأداء="))) == 0) {
+      profileFilename = args[i] + getStrLen(S("--تحليل-الأداء="));
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -118,6 +165,18 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tتنفيذ الجمل العليا المتتالية دفعة واحدة:\n");
+      outStream << S("\t\t--دفعي\n");
+      outStream << S("\t\t--batch\n");
+      outStream << S("\tطباعة تقرير بالوقت والذاكرة المستهلكة في كل مرحلة من مراحل البناء (json= لصيغة JSON):\n");
+      outStream << S("\t\t--تقرير-الوقت[=json]\n");
+      outStream << S("\t\t--time-report[=json]\n");
+      outStream << S("\tنشر رموز الشفرة المترجمة أثناء التنفيذ لأداة perf (/tmp/perf-<pid>.map) ولـ GDB:\n");
+      outStream << S("\t\t--رموز-التنفيذ\n");
+      outStream << S("\t\t--jit-symbols\n");
+      outStream << S("\tتحليل أداء البرنامج بأخذ عينات من مكدس الاستدعاءات وكتابتها بصيغة flame graph (profile.folded مبدئيًا):\n");
+      outStream << S("\t\t--تحليل-الأداء[=<ملف>]\n");
+      outStream << S("\t\t--profile[=<file>]\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +197,11 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--batch  Execute consecutive root statements together in a single batch.\n");
+      outStream << S("\t--time-report[=json]  Print the time and memory spent in each build phase, optionally in JSON.\n");
+      outStream << S("\t--jit-symbols  Publish the symbols of JIT compiled code to perf (/tmp/perf-<pid>.map) and GDB.\n");
+      outStream << S("\t--profile[=<file>]  Sample the call stacks of the program and write them in the folded format used\n"
+                     "\t\tby flame graph tools (profile.folded by default).\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -178,10 +242,34 @@ int main(int argCount, char * const args[])
     }
     return EXIT_SUCCESS;
   } else {
+    if (timeReport) {
+      allocationTimeReport = Main::TimeReport::getSingleton();
+      allocationTimeReport->enable();
+    }
+    // Print the time report, if requested, when leaving this block regardless of how the processing ends.
+    Finally printTimeReport([=]()->void {
+      if (!timeReport) return;
+      if (timeReportJson) Main::TimeReport::getSingleton()->printJson(outStream);
+      else Main::TimeReport::getSingleton()->print(outStream);
+    });
+    if (profileFilename != 0) Main::Profiler::getSingleton()->enable(profileFilename);
+    Finally writeProfile([=]()->void {
+      if (profileFilename == 0) return;
+      if (!Main::Profiler::getSingleton()->writeReport()) {
+        if (lang == S("ar")) {
+          outStream << S("تعذرت كتابة ملف تحليل الأداء: ") << profileFilename << NEW_LINE;
+        } else {
+          outStream << S("Could not write the profile file: ") << profileFilename << NEW_LINE;
+        }
+      }
+    });
+
     // Parse the provided source file.
     try {
       // Prepare the root object;
       Main::RootManager root;
+      root.setBatchExecution(batch);
+      root.setPublishingJitSymbols(jitSymbols);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
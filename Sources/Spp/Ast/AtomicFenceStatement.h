@@ -0,0 +1,100 @@
+/**
+ * @file Spp/Ast/AtomicFenceStatement.h
+ * Contains the header of class Spp::Ast::AtomicFenceStatement.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_ATOMICFENCESTATEMENT_H
+#define SPP_AST_ATOMICFENCESTATEMENT_H
+
+namespace Spp::Ast
+{
+
+/**
+ * @brief A memory fence with an optional ordering.
+ * @ingroup spp_ast
+ *
+ * The ordering is the name of one of the atomic memory orderings, and
+ * defaults to sequential consistency when missing.
+ */
+class AtomicFenceStatement : public Core::Data::Node,
+                             public Binding, public MapContaining<TiObject>,
+                             public Core::Data::Ast::MetaHaving, public Core::Data::Printable
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(AtomicFenceStatement, Core::Data::Node, "Spp.Ast", "Spp", "alusus.org");
+  IMPLEMENT_INTERFACES(
+    Core::Data::Node, Binding, MapContaining<TiObject>,
+    Core::Data::Ast::MetaHaving, Core::Data::Printable
+  );
+  OBJECT_FACTORY(AtomicFenceStatement);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: SharedPtr<Core::Data::Ast::Identifier> ordering;
+
+
+  //============================================================================
+  // Implementations
+
+  IMPLEMENT_METAHAVING(AtomicFenceStatement);
+
+  IMPLEMENT_BINDING(Binding,
+    (prodId, TiWord, VALUE, setProdId(value), &prodId),
+    (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
+  );
+
+  IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
+    (ordering, Core::Data::Ast::Identifier, SHARED_REF, setOrdering(value), ordering.get())
+  );
+
+  IMPLEMENT_AST_MAP_PRINTABLE(AtomicFenceStatement);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(AtomicFenceStatement);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(AtomicFenceStatement);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(AtomicFenceStatement);
+
+  public: virtual ~AtomicFenceStatement()
+  {
+    DISOWN_SHAREDPTR(this->ordering);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setOrdering(SharedPtr<Core::Data::Ast::Identifier> const &o)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->ordering, o);
+  }
+  private: void setOrdering(Core::Data::Ast::Identifier *o)
+  {
+    this->setOrdering(getSharedPtr(o));
+  }
+
+  public: SharedPtr<Core::Data::Ast::Identifier> const& getOrdering() const
+  {
+    return this->ordering;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file Spp/Ast/AtomicOp.h
+ * Contains the header of class Spp::Ast::AtomicOp.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_ATOMICOP_H
+#define SPP_AST_ATOMICOP_H
+
+namespace Spp::Ast
+{
+
+/**
+ * @brief An atomic operation on a variable.
+ * @ingroup spp_ast
+ *
+ * Represents the ~atomic_* family of operators. The operation is one of
+ * `load`, `store`, `add`, `sub`, `xchg` or `cas`, and the param holds the
+ * operation's arguments, if any.
+ */
+class AtomicOp : public Core::Data::Node,
+                 public Binding, public MapContaining<TiObject>,
+                 public Core::Data::Ast::MetaHaving, public Core::Data::Printable
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(AtomicOp, Core::Data::Node, "Spp.Ast", "Spp", "alusus.org");
+  IMPLEMENT_INTERFACES(
+    Core::Data::Node, Binding, MapContaining<TiObject>,
+    Core::Data::Ast::MetaHaving, Core::Data::Printable
+  );
+  OBJECT_FACTORY(AtomicOp);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: TiStr operation;
+  private: TioSharedPtr operand;
+  private: TioSharedPtr param;
+
+
+  //============================================================================
+  // Implementations
+
+  IMPLEMENT_METAHAVING(AtomicOp);
+
+  IMPLEMENT_BINDING(Binding,
+    (operation, TiStr, VALUE, setOperation(value), &operation),
+    (prodId, TiWord, VALUE, setProdId(value), &prodId),
+    (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
+  );
+
+  IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
+    (operand, TiObject, SHARED_REF, setOperand(value), operand.get()),
+    (param, TiObject, SHARED_REF, setParam(value), param.get())
+  );
+
+  IMPLEMENT_AST_MAP_PRINTABLE(AtomicOp, << this->operation.get());
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(AtomicOp);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(AtomicOp);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(AtomicOp);
+
+  public: virtual ~AtomicOp()
+  {
+    DISOWN_SHAREDPTR(this->operand);
+    DISOWN_SHAREDPTR(this->param);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setOperation(Char const *o)
+  {
+    this->operation = o;
+  }
+  public: void setOperation(TiStr const *o)
+  {
+    this->operation = o == 0 ? "" : o->get();
+  }
+
+  public: TiStr const& getOperation() const
+  {
+    return this->operation;
+  }
+
+  public: void setOperand(TioSharedPtr const &o)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->operand, o);
+  }
+  private: void setOperand(TiObject *o)
+  {
+    this->setOperand(getSharedPtr(o));
+  }
+
+  public: TioSharedPtr const& getOperand() const
+  {
+    return this->operand;
+  }
+
+  public: void setParam(TioSharedPtr const &p)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->param, p);
+  }
+  private: void setParam(TiObject *p)
+  {
+    this->setParam(getSharedPtr(p));
+  }
+
+  public: TioSharedPtr const& getParam() const
+  {
+    return this->param;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
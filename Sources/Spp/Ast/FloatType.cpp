@@ -48,6 +48,12 @@ TypeMatchStatus FloatType::matchTargetType(
       else return TypeMatchStatus::IMPLICIT_CAST;
     } else if (type->isDerivedFrom<IntegerType>()) {
       return TypeMatchStatus::IMPLICIT_CAST;
+    } else if (type->isDerivedFrom<VectorType>()) {
+      // Scalars are splatted into all the elements of the vector.
+      auto elementType = static_cast<VectorType const*>(type)->getElementType(helper);
+      auto elementMatch = this->matchTargetType(elementType, helper, ec, opts);
+      if (elementMatch >= TypeMatchStatus::IMPLICIT_CAST) return TypeMatchStatus::IMPLICIT_CAST;
+      else return elementMatch;
     } else {
       return TypeMatchStatus::NONE;
     }
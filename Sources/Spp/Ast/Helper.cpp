@@ -35,6 +35,7 @@ void Helper::initBindingCaches()
     &this->getReferenceTypeFor,
     &this->getPointerTypeFor,
     &this->getArrayTypeFor,
+    &this->getVectorTypeFor,
     &this->getValueTypeFor,
     &this->getNullType,
     &this->getBoolType,
@@ -74,6 +75,7 @@ void Helper::initBindings()
   this->getReferenceTypeFor = &Helper::_getReferenceTypeFor;
   this->getPointerTypeFor = &Helper::_getPointerTypeFor;
   this->getArrayTypeFor = &Helper::_getArrayTypeFor;
+  this->getVectorTypeFor = &Helper::_getVectorTypeFor;
   this->getValueTypeFor = &Helper::_getValueTypeFor;
   this->getNullType = &Helper::_getNullType;
   this->getBoolType = &Helper::_getBoolType;
@@ -267,14 +269,14 @@ Bool Helper::_lookupCalleeOnObject(
     } else {
       return false;
     }
-  } else if (obj != 0 && obj->isDerivedFrom<ArrayType>()) {
+  } else if (obj != 0 && (obj->isDerivedFrom<ArrayType>() || obj->isDerivedFrom<VectorType>())) {
     if (
       types != 0 && types->getElementCount() == 1 &&
       helper->isImplicitlyCastableTo(types->getElement(0), helper->getArchIntType(), ec)
     ) {
       if (result.matchStatus < TypeMatchStatus::EXACT) {
         result.matchStatus = TypeMatchStatus::EXACT;
-        result.type = static_cast<ArrayType*>(obj);
+        result.type = static_cast<Type*>(obj);
         result.notice.reset();
         return true;
       } else {
@@ -767,6 +769,35 @@ ArrayType* Helper::_getArrayTypeFor(TiObject *self, TiObject *type)
 }
 
 
+VectorType* Helper::_getVectorTypeFor(TiObject *self, Type *elementType, Word size)
+{
+  PREPARE_SELF(helper, Helper);
+
+  auto tpl = helper->getVectorTemplate();
+
+  // The template vars are passed already traced since the element type is an existing type that shouldn't be
+  // reparented into a temporary list of template inputs.
+  auto sizeLiteral = Core::Data::Ast::IntegerLiteral::create({
+    { S("value"), TiStr(std::to_string(size).c_str()) }
+  });
+  PlainList<TiObject> vars({ elementType, sizeLiteral.get() });
+
+  TioSharedPtr result;
+  if (tpl->matchInstanceForVars(&vars, SharedPtr<Core::Data::SourceLocation>(), helper, result)) {
+    auto vectorType = result.ti_cast_get<VectorType>();
+    if (vectorType == 0) {
+      throw EXCEPTION(GenericException, S("Template for vector type is invalid."));
+    }
+    return vectorType;
+  } else {
+    auto notice = result.ti_cast<Core::Notices::Notice>();
+    if (notice != 0) {
+      helper->noticeStore->add(notice);
+    }
+    return 0;
+  }
+}
+
 Type* Helper::swichInnerReferenceTypeWithPointerType(ReferenceType *type)
 {
   if (type == 0) {
@@ -1281,4 +1312,20 @@ Template* Helper::getArrayTemplate()
   return this->arrayTemplate;
 }
 
+
+Template* Helper::getVectorTemplate()
+{
+  if (this->vectorTemplate != 0) return this->vectorTemplate;
+
+  Core::Data::Ast::Identifier identifier;
+  identifier.setValue(S("Vector"));
+  this->vectorTemplate = ti_cast<Template>(rootManager->getSeeker()->doGet(
+    &identifier, this->rootManager->getRootScope().get())
+  );
+  if (this->vectorTemplate == 0) {
+    throw EXCEPTION(GenericException, S("Invalid object found for Vector template."));
+  }
+  return this->vectorTemplate;
+}
+
 } } // namespace
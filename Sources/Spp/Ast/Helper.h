@@ -40,6 +40,7 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   private: Template *ndrefTemplate = 0;
   private: Template *ptrTemplate = 0;
   private: Template *arrayTemplate = 0;
+  private: Template *vectorTemplate = 0;
   private: IntegerType *nullType = 0;
   private: IntegerType *boolType = 0;
   private: IntegerType *charType = 0;
@@ -213,6 +214,9 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(getArrayTypeFor, ArrayType*, (TiObject*));
   private: static ArrayType* _getArrayTypeFor(TiObject *self, TiObject *type);
 
+  public: METHOD_BINDING_CACHE(getVectorTypeFor, VectorType*, (Type*, Word));
+  private: static VectorType* _getVectorTypeFor(TiObject *self, Type *elementType, Word size);
+
   public: Type* swichInnerReferenceTypeWithPointerType(ReferenceType *type);
 
   public: Type* swichOuterPointerTypeWithReferenceType(Type *type, ReferenceMode const &mode);
@@ -326,6 +330,8 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
 
   private: Template* getArrayTemplate();
 
+  private: Template* getVectorTemplate();
+
   /// @}
 
 }; // class
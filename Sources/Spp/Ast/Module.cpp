@@ -20,6 +20,7 @@ Bool Module::merge(TiObject *src, Core::Data::Seeker *seeker, Core::Notices::Sto
   VALIDATE_NOT_NULL(src, noticeStore);
   if (src->isA<Core::Data::Ast::Scope>() || src->isA<Module>()) {
     auto scope = static_cast<Core::Data::Ast::Scope*>(src);
+    CodeGen::resetAstProcessedWithOwners(this);
     return Core::Data::Ast::addPossiblyMergeableElements(scope, this, seeker, noticeStore);
   }
   noticeStore->add(
@@ -54,10 +54,24 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
     return false;
   }
 
+  return this->matchInstanceForVars(&vars, Core::Data::Ast::findSourceLocation(templateInputs), helper, result);
+}
+
+
+Bool Template::matchInstanceForVars(
+  Containing<TiObject> *vars, SharedPtr<Core::Data::SourceLocation> const &sourceLocation, Helper *helper,
+  TioSharedPtr &result
+) {
+  if (this->body == 0) {
+    throw EXCEPTION(GenericException, S("Template body is not set."));
+  }
+
+  SharedPtr<Core::Notices::Notice> notice;
+
   // Do we already have an instance?
   auto count = this->instances.getCount();
   for (Int i = 0; i < count; ++i) {
-    if (this->matchTemplateVars(&vars, this->instances.getElement(i), helper, notice)) {
+    if (this->matchTemplateVars(vars, this->instances.getElement(i), helper, notice)) {
       result = this->instances.get(i)->get(0);
       return true;
     } else {
@@ -70,9 +84,9 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
 
   // No instance was found, create a new one.
   auto block = newSrdObj<Core::Data::Ast::Scope>();
-  block->setSourceLocation(Core::Data::Ast::findSourceLocation(templateInputs));
-  block->add(Core::Data::Ast::clone(this->body.get(), Core::Data::Ast::findSourceLocation(templateInputs).get()));
-  if (!this->assignTemplateVars(&vars, block.get(), helper, notice)) {
+  block->setSourceLocation(sourceLocation);
+  block->add(Core::Data::Ast::clone(this->body.get(), sourceLocation.get()));
+  if (!this->assignTemplateVars(vars, block.get(), helper, notice)) {
     result = notice;
     return false;
   }
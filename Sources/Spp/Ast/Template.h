@@ -110,6 +110,10 @@ class Template : public Core::Data::Node,
 
   public: virtual TioSharedPtr const& getDefaultInstance(Helper *helper);
   public: virtual Bool matchInstance(TiObject *templateInputs, Helper *helper, TioSharedPtr &result);
+  public: Bool matchInstanceForVars(
+    Containing<TiObject> *vars, SharedPtr<Core::Data::SourceLocation> const &sourceLocation, Helper *helper,
+    TioSharedPtr &result
+  );
 
   private: Bool prepareTemplateVars(
     TiObject *templateInputs, Helper *helper, PlainList<TiObject> *vars, SharedPtr<Core::Notices::Notice> &notice
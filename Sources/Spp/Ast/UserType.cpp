@@ -53,9 +53,11 @@ Bool UserType::merge(TiObject *src, Core::Data::Seeker *seeker, Core::Notices::S
   VALIDATE_NOT_NULL(src, noticeStore);
   if (src->isA<Core::Data::Ast::Scope>()) {
     auto scope = static_cast<Core::Data::Ast::Scope*>(src);
+    CodeGen::resetAstProcessedWithOwners(this->getBody().get());
     return Core::Data::Ast::addPossiblyMergeableElements(scope, this->getBody().get(), seeker, noticeStore);
   } else if (src->isDerivedFrom<UserType>()) {
     auto scope = static_cast<UserType*>(src)->getBody().get();
+    CodeGen::resetAstProcessedWithOwners(this->getBody().get());
     return Core::Data::Ast::addPossiblyMergeableElements(scope, this->getBody().get(), seeker, noticeStore);
   } else {
     noticeStore->add(
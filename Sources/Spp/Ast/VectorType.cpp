@@ -0,0 +1,73 @@
+/**
+ * @file Spp/Ast/VectorType.cpp
+ * Contains the implementation of class Spp::Ast::VectorType.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::Ast
+{
+
+//==============================================================================
+// Member Functions
+
+Type* VectorType::getElementType(Helper *helper) const
+{
+  if (this->elementTypeRef == 0) {
+    this->elementTypeRef = helper->getRootManager()->parseExpression(S("type"));
+  }
+  auto typeBox = ti_cast<TioWeakBox>(
+    helper->getSeeker()->doGet(this->elementTypeRef.get(), this->getOwner())
+  );
+  if (typeBox == 0) return 0;
+  auto type = typeBox->get().ti_cast_get<Spp::Ast::Type>();
+  if (type == 0) {
+    throw EXCEPTION(GenericException, S("Invalid vector element type found."));
+  }
+  return type;
+}
+
+
+Word VectorType::getSize(Helper *helper) const
+{
+  if (this->sizeRef == 0) {
+    this->sizeRef = helper->getRootManager()->parseExpression(S("size"));
+  }
+  auto size = ti_cast<Core::Data::Ast::IntegerLiteral>(
+    helper->getSeeker()->doGet(this->sizeRef.get(), this->getOwner())
+  );
+  if (size == 0) {
+    throw EXCEPTION(GenericException, S("Could not find size value."));
+  }
+  return std::stol(size->getValue().get());
+}
+
+
+TypeMatchStatus VectorType::matchTargetType(
+  Type const *type, Helper *helper, ExecutionContext const *ec, TypeMatchOptions opts
+) const
+{
+  if (this == type) return TypeMatchStatus::EXACT;
+
+  auto vectorType = ti_cast<VectorType const>(type);
+  if (vectorType == 0 || this->getSize(helper) != vectorType->getSize(helper)) return TypeMatchStatus::NONE;
+
+  // Vectors of the same size can be converted element-wise, but only explicitly since that changes the lane width.
+  auto thisElementType = this->getElementType(helper);
+  auto targetElementType = vectorType->getElementType(helper);
+  if (thisElementType->isEqual(targetElementType, helper, ec)) return TypeMatchStatus::EXACT;
+  else if (thisElementType->isExplicitlyCastableTo(targetElementType, helper, ec)) {
+    return TypeMatchStatus::EXPLICIT_CAST;
+  } else {
+    return TypeMatchStatus::NONE;
+  }
+}
+
+} // namespace
@@ -0,0 +1,70 @@
+/**
+ * @file Spp/Ast/VectorType.h
+ * Contains the header of class Spp::Ast::VectorType.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_VECTORTYPE_H
+#define SPP_AST_VECTORTYPE_H
+
+namespace Spp::Ast
+{
+
+/**
+ * @brief A fixed size SIMD vector of integers or floats.
+ * @ingroup spp_ast
+ *
+ * Instances of the builtin Vector[type, size] template. Arithmetic, binary,
+ * and comparison operators apply element-wise, and scalars are implicitly
+ * splatted into all the elements when mixed with vectors.
+ */
+class VectorType : public DataType
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(VectorType, DataType, "Spp.Ast", "Spp", "alusus.org");
+  OBJECT_FACTORY(VectorType);
+
+  IMPLEMENT_AST_MAP_PRINTABLE(VectorType);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: mutable TioSharedPtr elementTypeRef;
+  private: mutable TioSharedPtr sizeRef;
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(VectorType);
+
+
+  //============================================================================
+  // Member Functions
+
+  public: Type* getElementType(Helper *helper) const;
+
+  public: Word getSize(Helper *helper) const;
+
+  public: virtual TypeMatchStatus matchTargetType(
+    Type const *type, Helper *helper, ExecutionContext const *ec, TypeMatchOptions opts = TypeMatchOptions::NONE
+  ) const;
+
+}; // class
+
+} // namespace
+
+#endif
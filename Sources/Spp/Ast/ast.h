@@ -126,6 +126,7 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "PointerType.h"
 #include "ReferenceType.h"
 #include "ArrayType.h"
+#include "VectorType.h"
 #include "UserType.h"
 #include "FunctionType.h"
 #include "Macro.h"
@@ -141,6 +142,7 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "ContinueStatement.h"
 #include "BreakStatement.h"
 #include "ReturnStatement.h"
+#include "AtomicFenceStatement.h"
 #include "EvalStatement.h"
 // Operators
 #include "PointerOp.h"
@@ -154,6 +156,8 @@ DEFINE_TYPE_NAME(Spp::Ast::CalleeLookupResult, "alusus.org/Spp/Spp.Ast.CalleeLoo
 #include "InitOp.h"
 #include "TerminateOp.h"
 #include "NextArgOp.h"
+#include "AtomicOp.h"
+#include "VectorOp.h"
 // Misc
 #include "ArgPack.h"
 #include "ThisTypeRef.h"
@@ -68,11 +68,13 @@ void BuildManager::initTargets()
 {
   this->jitEda.setIdPrefix("jit");
   this->jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo);
+  this->jitBuildTarget->setPublishingSymbols(this->rootManager->isPublishingJitSymbols());
   this->jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(this->jitBuildTarget.get(), false);
   this->jitTargetGenerator->setupBuild();
 
   this->evalEda.setIdPrefix("eval");
   this->evalBuildTarget = newSrdObj<LlvmCodeGen::LazyJitBuildTarget>(this->globalItemRepo);
+  this->evalBuildTarget->setPublishingSymbols(this->rootManager->isPublishingJitSymbols());
   this->evalTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     this->jitTargetGenerator.get(), this->evalBuildTarget.get(), true
   );
@@ -161,6 +163,7 @@ SharedPtr<BuildSession> BuildManager::_prepareBuild(
 
 Bool BuildManager::_addElementToBuild(TiObject *self, TiObject *element, BuildSession *buildSession)
 {
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
 
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
@@ -189,6 +192,7 @@ Bool BuildManager::_addElementToBuild(TiObject *self, TiObject *element, BuildSe
 Bool BuildManager::_finalizeBuild(
   TiObject *self, Core::Notices::Store *noticeStore, TiObject *globalFuncElement, BuildSession *buildSession
 ) {
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
 
@@ -244,6 +248,7 @@ Bool BuildManager::_execute(TiObject *self, Core::Notices::Store *noticeStore, B
 
 Bool BuildManager::_buildDependencies(TiObject *self, Core::Notices::Store *noticeStore, BuildSession *buildSession)
 {
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
 
@@ -455,7 +460,7 @@ void BuildManager::_dumpLlvmIrForElement(
 
 Bool BuildManager::_buildObjectFileForElement(
   TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
-  Core::Notices::Store *noticeStore, Core::Processing::Parser *parser
+  BuildOptions const *options, Core::Notices::Store *noticeStore, Core::Processing::Parser *parser
 ) {
   VALIDATE_NOT_NULL(element, noticeStore);
   PREPARE_SELF(buildMgr, BuildManager);
@@ -464,6 +469,7 @@ Bool BuildManager::_buildObjectFileForElement(
   if (element->isDerivedFrom<Ast::Module>()) globalFuncElement = element;
 
   buildMgr->offlineBuildTarget->setTargetTriple(targetTriple);
+  buildMgr->offlineBuildTarget->setBuildOptions(options);
 
   SharedPtr<BuildSession> buildSession = buildMgr->prepareBuild(
     noticeStore, BuildManager::BuildType::OFFLINE, globalFuncElement
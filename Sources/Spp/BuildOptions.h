@@ -0,0 +1,52 @@
+/**
+* @file Spp/BuildOptions.h
+*
+* @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+*
+* @license This file is released under Alusus Public License, Version 1.0.
+* For details on usage and copying conditions read the full license in the
+* accompanying license file or at <https://alusus.org/license.html>.
+*/
+//==============================================================================
+
+#ifndef SPP_BUILDOPTIONS_H
+#define SPP_BUILDOPTIONS_H
+
+namespace Spp
+{
+
+/**
+ * @brief Options that control offline (object file) builds.
+ * @ingroup spp
+ *
+ * This struct is shared with the runtime as is (Spp.BuildOptions in
+ * Spp.alusus) so its layout must be kept in sync with the Alusus definition.
+ */
+struct BuildOptions
+{
+  /// Target CPU name. Null or empty means generic, and "native" means the host CPU.
+  Char const *cpu;
+  /// Comma separated LLVM target feature string, e.g. "+avx2,-sse4a".
+  Char const *features;
+  /// Optimization level, between 0 and 3.
+  Int optLevel;
+  /// Size optimization level, between 0 and 2 (1 for -Os, 2 for -Oz).
+  Int sizeLevel;
+  /// Number of partitions to split the module into, each optimized and emitted on its own thread. Partition
+  /// number i is written to <filename>.<i>.o instead of the requested filename. Values below 2 disable splitting.
+  Int partitionCount;
+  /// Emit LLVM bitcode instead of native object code, to be consumed by an LTO linker.
+  Bool emitBitcode;
+  /// Instrument the generated code to record edge and call counts into the given raw profile file at exit. The
+  /// executable must be linked against the compiler-rt profile runtime. Null disables instrumentation.
+  Char const *profileGenerate;
+  /// Indexed profile (.profdata, merged from raw profiles using llvm-profdata) to drive optimizations with. Null
+  /// disables profile guided optimization.
+  Char const *profileUse;
+};
+
+} // namespace
+
+DEFINE_TYPE_NAME(Spp::BuildOptions, "alusus.org/Spp/Spp.BuildOptions");
+
+#endif
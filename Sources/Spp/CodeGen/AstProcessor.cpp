@@ -78,6 +78,7 @@ void AstProcessor::preparePass(Core::Notices::Store *noticeStore)
 
 Bool AstProcessor::_process(TiObject *self, TiObject *owner)
 {
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::MACRO_PROCESSING);
   PREPARE_SELF(astProcessor, AstProcessor);
   VALIDATE_NOT_NULL(owner);
 
@@ -123,7 +124,11 @@ Bool AstProcessor::_process(TiObject *self, TiObject *owner)
       if (astProcessor->processEvalStatement(static_cast<Ast::EvalStatement*>(child), owner, i)) --i;
       else result = false;
     } else {
+      // Skip subtrees that were fully processed in a previous pass. Merges into a subtree reset its flag.
+      auto metaHaving = ti_cast<Core::Data::Ast::MetaHaving>(child);
+      if (metaHaving != 0 && isAstProcessed(metaHaving)) continue;
       if (!astProcessor->process(child)) result = false;
+      else if (metaHaving != 0) setAstProcessed(metaHaving, true);
     }
   }
 
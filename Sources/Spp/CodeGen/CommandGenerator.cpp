@@ -26,7 +26,8 @@ void CommandGenerator::initBindingCaches()
     &this->generateWhileStatement,
     &this->generateForStatement,
     &this->generateContinueStatement,
-    &this->generateBreakStatement
+    &this->generateBreakStatement,
+    &this->generateAtomicFenceStatement
   });
 }
 
@@ -39,6 +40,7 @@ void CommandGenerator::initBindings()
   this->generateForStatement = &CommandGenerator::_generateForStatement;
   this->generateContinueStatement = &CommandGenerator::_generateContinueStatement;
   this->generateBreakStatement = &CommandGenerator::_generateBreakStatement;
+  this->generateAtomicFenceStatement = &CommandGenerator::_generateAtomicFenceStatement;
 }
 
 
@@ -147,26 +149,37 @@ Bool CommandGenerator::_generateIfStatement(
   Session condSession(session, ifTgContext->getConditionContext());
   if (!cmdGenerator->generateCondition(astNode->getCondition().get(), g, &condSession, conditionResult)) return false;
 
+  // If the condition is constant, skip the dead branch. A skipped branch never falls through.
+  Bool constantCondition;
+  Bool constant = ConstantFolder(cmdGenerator->astHelper, session->getExecutionContext(), true).foldCondition(
+    astNode->getCondition().get(), constantCondition
+  );
+
   // Generate ifBody.
-  TerminalStatement terminalBody = TerminalStatement::UNKNOWN;
+  TerminalStatement terminalBody = TerminalStatement::YES;
   Session bodySession(session, ifTgContext->getBodyContext());
-  if (ifBody->isDerivedFrom<Core::Data::Ast::Scope>()) {
-    session->getEda()->setCodeGenData(
-      static_cast<Core::Data::Ast::Scope*>(ifBody), getSharedPtr(ifTgContext->getBodyContext())
-    );
+  if (!constant || constantCondition) {
+    if (ifBody->isDerivedFrom<Core::Data::Ast::Scope>()) {
+      session->getEda()->setCodeGenData(
+        static_cast<Core::Data::Ast::Scope*>(ifBody), getSharedPtr(ifTgContext->getBodyContext())
+      );
+    }
+    if (!g->generateStatementBlock(ifBody, &bodySession, terminalBody)) return false;
   }
-  if (!g->generateStatementBlock(ifBody, &bodySession, terminalBody)) return false;
 
   // Generate elseBody, if needed.
   TerminalStatement terminalElse = TerminalStatement::UNKNOWN;
   Session elseSession(session, ifTgContext->getElseContext());
   if (elseBody != 0) {
-    if (elseBody->isDerivedFrom<Core::Data::Ast::Scope>()) {
-      session->getEda()->setCodeGenData(
-        static_cast<Core::Data::Ast::Scope*>(elseBody), getSharedPtr(ifTgContext->getElseContext())
-      );
+    terminalElse = TerminalStatement::YES;
+    if (!constant || !constantCondition) {
+      if (elseBody->isDerivedFrom<Core::Data::Ast::Scope>()) {
+        session->getEda()->setCodeGenData(
+          static_cast<Core::Data::Ast::Scope*>(elseBody), getSharedPtr(ifTgContext->getElseContext())
+        );
+      }
+      if (!g->generateStatementBlock(elseBody, &elseSession, terminalElse)) return false;
     }
-    if (!g->generateStatementBlock(elseBody, &elseSession, terminalElse)) return false;
   }
 
   terminal = terminalBody == TerminalStatement::YES && terminalElse == TerminalStatement::YES ?
@@ -359,6 +372,27 @@ Bool CommandGenerator::_generateBreakStatement(
 }
 
 
+Bool CommandGenerator::_generateAtomicFenceStatement(
+  TiObject *self, Spp::Ast::AtomicFenceStatement *astNode, Generation *g, Session *session
+) {
+  PREPARE_SELF(cmdGenerator, CommandGenerator);
+
+  // A fence orders memory accesses around it, so a relaxed fence would be meaningless.
+  Int ordering = AtomicOrdering::SEQ_CST;
+  if (
+    astNode->getOrdering() != 0 &&
+    (!getAtomicOrdering(astNode->getOrdering().get(), ordering) || ordering == AtomicOrdering::RELAXED)
+  ) {
+    cmdGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOrderingNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  return session->getTg()->generateAtomicFence(session->getTgContext(), ordering);
+}
+
+
 //==============================================================================
 // Helper Functions
 
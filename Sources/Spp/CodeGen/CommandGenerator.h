@@ -147,6 +147,15 @@ class CommandGenerator : public TiObject, public DynamicBinding, public DynamicI
     TiObject *self, Spp::Ast::BreakStatement *astNode, Generation *g, Session *session
   );
 
+  public: METHOD_BINDING_CACHE(generateAtomicFenceStatement,
+    Bool, (
+      Spp::Ast::AtomicFenceStatement* /* astNode */, Generation* /* g */, Session* /* session */
+    )
+  );
+  private: static Bool _generateAtomicFenceStatement(
+    TiObject *self, Spp::Ast::AtomicFenceStatement *astNode, Generation *g, Session *session
+  );
+
   /// @}
 
   /// @name Helper Functions
@@ -0,0 +1,486 @@
+/**
+ * @file Spp/CodeGen/ConstantFolder.cpp
+ * Contains the implementation of class Spp::CodeGen::ConstantFolder.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+#include <cmath>
+
+namespace Spp::CodeGen
+{
+
+//==============================================================================
+// Folding Functions
+
+Bool ConstantFolder::fold(TiObject *astNode, Constant &result)
+{
+  // Check the structure of the expression first to avoid looking up literal types for expressions that can't be
+  // folded anyway.
+  return this->isFoldable(astNode) && this->foldNode(astNode, result);
+}
+
+
+Bool ConstantFolder::foldCondition(TiObject *astNode, Bool &result)
+{
+  Constant constant;
+  if (!this->fold(astNode, constant)) return false;
+  // Only booleans are implicitly castable to conditions.
+  if (constant.isFloat || constant.bitCount != 1) return false;
+  result = constant.intValue != 0;
+  return true;
+}
+
+
+Bool ConstantFolder::isFoldable(TiObject *astNode)
+{
+  if (astNode == 0) return false;
+  if (
+    astNode->isDerivedFrom<Core::Data::Ast::IntegerLiteral>() || astNode->isDerivedFrom<Core::Data::Ast::FloatLiteral>()
+  ) {
+    return true;
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::Bracket>()) {
+    auto bracket = static_cast<Core::Data::Ast::Bracket*>(astNode);
+    return bracket->getType() == Core::Data::Ast::BracketType::ROUND && this->isFoldable(bracket->getOperand().get());
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::InfixOperator>()) {
+    auto infixOp = static_cast<Core::Data::Ast::InfixOperator*>(astNode);
+    return this->isFoldable(infixOp->getFirst().get()) && this->isFoldable(infixOp->getSecond().get());
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::PrefixOperator>()) {
+    return this->isFoldable(static_cast<Core::Data::Ast::PrefixOperator*>(astNode)->getOperand().get());
+  } else {
+    return this->resolvingIdentifiers && astNode->isDerivedFrom<Core::Data::Ast::Identifier>();
+  }
+}
+
+
+Bool ConstantFolder::foldNode(TiObject *astNode, Constant &result)
+{
+  if (astNode == 0) return false;
+
+  if (astNode->isDerivedFrom<Core::Data::Ast::IntegerLiteral>()) {
+    LongWord value;
+    Word size;
+    Bool signedNum;
+    auto astType = this->parseIntegerLiteral(
+      static_cast<Core::Data::Ast::IntegerLiteral*>(astNode), value, size, signedNum
+    );
+    if (size > 64) return false;
+    this->setIntResult(astType, value, result);
+    return true;
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::FloatLiteral>()) {
+    Double value;
+    Word size;
+    auto astType = this->parseFloatLiteral(static_cast<Core::Data::Ast::FloatLiteral*>(astNode), value, size);
+    if (size != 32 && size != 64) return false;
+    this->setFloatResult(astType, value, result);
+    return true;
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::Bracket>()) {
+    auto bracket = static_cast<Core::Data::Ast::Bracket*>(astNode);
+    if (bracket->getType() != Core::Data::Ast::BracketType::ROUND) return false;
+    return this->foldNode(bracket->getOperand().get(), result);
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::InfixOperator>()) {
+    return this->foldInfixOp(static_cast<Core::Data::Ast::InfixOperator*>(astNode), result);
+  } else if (astNode->isDerivedFrom<Core::Data::Ast::PrefixOperator>()) {
+    return this->foldPrefixOp(static_cast<Core::Data::Ast::PrefixOperator*>(astNode), result);
+  } else if (this->resolvingIdentifiers && astNode->isDerivedFrom<Core::Data::Ast::Identifier>()) {
+    // Follow identifiers that refer to literal definitions like `def true: 1`.
+    auto identifier = static_cast<Core::Data::Ast::Identifier*>(astNode);
+    PlainList<TiObject> stack;
+    if (!this->astHelper->lookupReferenceTarget(identifier->getOwner(), identifier, true, stack)) return false;
+    TiObject *obj = stack.get(stack.getCount() - 1);
+    auto box = ti_cast<TioWeakBox>(obj);
+    if (box != 0) obj = box->get().get();
+    if (obj == 0) return false;
+    if (
+      !obj->isDerivedFrom<Core::Data::Ast::IntegerLiteral>() && !obj->isDerivedFrom<Core::Data::Ast::FloatLiteral>()
+    ) return false;
+    return this->foldNode(obj, result);
+  } else {
+    return false;
+  }
+}
+
+
+Bool ConstantFolder::foldInfixOp(Core::Data::Ast::InfixOperator *astNode, Constant &result)
+{
+  auto op = astNode->getType().get();
+  Constant first, second;
+  if (!this->foldNode(astNode->getFirst().get(), first)) return false;
+  if (!this->foldNode(astNode->getSecond().get(), second)) return false;
+
+  if (
+    compareStr(op, S("+")) == 0 || compareStr(op, S("-")) == 0 || compareStr(op, S("*")) == 0 ||
+    compareStr(op, S("/")) == 0 || compareStr(op, S("%")) == 0
+  ) {
+    return this->foldArithmeticOp(op, first, second, result);
+  } else if (
+    compareStr(op, S(">>")) == 0 || compareStr(op, S("<<")) == 0 || compareStr(op, S("&")) == 0 ||
+    compareStr(op, S("|")) == 0 || compareStr(op, S("$")) == 0
+  ) {
+    return this->foldBinaryOp(op, first, second, result);
+  } else if (
+    compareStr(op, S("==")) == 0 || compareStr(op, S("!=")) == 0 || compareStr(op, S(">")) == 0 ||
+    compareStr(op, S(">=")) == 0 || compareStr(op, S("<")) == 0 || compareStr(op, S("<=")) == 0
+  ) {
+    return this->foldComparisonOp(op, first, second, result);
+  } else if (
+    compareStr(op, S("||")) == 0 || compareStr(op, S("or")) == 0 ||
+    compareStr(op, S("&&")) == 0 || compareStr(op, S("and")) == 0
+  ) {
+    // Logical operands are cast to booleans, which is only possible for booleans.
+    if (first.isFloat || first.bitCount != 1 || second.isFloat || second.bitCount != 1) return false;
+    Bool value = op[0] == C('|') || op[0] == C('o') ?
+      (first.intValue != 0 || second.intValue != 0) :
+      (first.intValue != 0 && second.intValue != 0);
+    this->setIntResult(this->astHelper->getBoolType(), value, result);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+
+Bool ConstantFolder::foldPrefixOp(Core::Data::Ast::PrefixOperator *astNode, Constant &result)
+{
+  auto op = astNode->getType().get();
+  Constant operand;
+  if (!this->foldNode(astNode->getOperand().get(), operand)) return false;
+
+  if (compareStr(op, S("+")) == 0) {
+    result = operand;
+    return true;
+  } else if (compareStr(op, S("-")) == 0) {
+    if (operand.isFloat) {
+      result = operand;
+      result.floatValue = -operand.floatValue;
+    } else {
+      // Like ExpressionGenerator::_generateUnaryValOp, negating an integer gives a signed integer of the same size.
+      this->setIntResult(
+        this->astHelper->getIntType(operand.bitCount), truncate(-operand.intValue, operand.bitCount), result
+      );
+    }
+    return true;
+  } else if (compareStr(op, S("!")) == 0) {
+    if (operand.isFloat) return false;
+    result = operand;
+    result.intValue = truncate(~operand.intValue, operand.bitCount);
+    return true;
+  } else if (compareStr(op, S("!!")) == 0 || compareStr(op, S("not")) == 0) {
+    if (operand.isFloat || operand.bitCount != 1) return false;
+    result = operand;
+    result.intValue = operand.intValue ^ 1;
+    return true;
+  } else {
+    return false;
+  }
+}
+
+
+Bool ConstantFolder::foldArithmeticOp(Char const *op, Constant &first, Constant &second, Constant &result)
+{
+  if (first.isFloat || second.isFloat) {
+    // The result takes the wider float type.
+    Constant const &floatOperand = !second.isFloat || (first.isFloat && first.bitCount >= second.bitCount) ?
+      first : second;
+    auto astType = static_cast<Ast::FloatType*>(floatOperand.astType);
+    Double value1 = this->getFloatValue(first, floatOperand.bitCount);
+    Double value2 = this->getFloatValue(second, floatOperand.bitCount);
+    Double value;
+    switch (op[0]) {
+      case C('+'): value = value1 + value2; break;
+      case C('-'): value = value1 - value2; break;
+      case C('*'): value = value1 * value2; break;
+      case C('/'): value = value1 / value2; break;
+      default: value = std::fmod(value1, value2); break;
+    }
+    this->setFloatResult(astType, value, result);
+    return true;
+  }
+
+  // Two integers.
+  auto targetBitCount = first.bitCount >= second.bitCount ? first.bitCount : second.bitCount;
+  if (targetBitCount < 32) targetBitCount = 32;
+  auto astType = !first.isSigned && !second.isSigned ?
+    this->astHelper->getWordType(targetBitCount) :
+    this->astHelper->getIntType(targetBitCount);
+  Constant value1, value2;
+  if (!this->castToIntType(first, astType, value1) || !this->castToIntType(second, astType, value2)) return false;
+
+  LongWord value;
+  switch (op[0]) {
+    case C('+'): value = value1.intValue + value2.intValue; break;
+    case C('-'): value = value1.intValue - value2.intValue; break;
+    case C('*'): value = value1.intValue * value2.intValue; break;
+    default: {
+      // Leave undefined divisions to run time.
+      if (value2.intValue == 0) return false;
+      if (astType->isSigned()) {
+        LongInt signed1 = signExtend(value1.intValue, targetBitCount);
+        LongInt signed2 = signExtend(value2.intValue, targetBitCount);
+        if (signed2 == -1 && value1.intValue == (1ull << (targetBitCount - 1))) return false;
+        value = op[0] == C('/') ? signed1 / signed2 : signed1 % signed2;
+      } else {
+        value = op[0] == C('/') ? value1.intValue / value2.intValue : value1.intValue % value2.intValue;
+      }
+    }
+  }
+  this->setIntResult(astType, value, result);
+  return true;
+}
+
+
+Bool ConstantFolder::foldBinaryOp(Char const *op, Constant &first, Constant &second, Constant &result)
+{
+  if (first.isFloat || second.isFloat) return false;
+
+  auto targetBitCount = first.bitCount >= second.bitCount ? first.bitCount : second.bitCount;
+  auto astType = !first.isSigned && !second.isSigned ?
+    this->astHelper->getWordType(targetBitCount) :
+    this->astHelper->getIntType(targetBitCount);
+  Constant value1, value2;
+  if (!this->castToIntType(first, astType, value1) || !this->castToIntType(second, astType, value2)) return false;
+
+  LongWord value;
+  if (compareStr(op, S(">>")) == 0 || compareStr(op, S("<<")) == 0) {
+    // Shifting by the bit count or more gives an undefined value, so leave it to run time.
+    if (value2.intValue >= targetBitCount) return false;
+    if (op[0] == C('<')) value = value1.intValue << value2.intValue;
+    else if (astType->isSigned()) value = signExtend(value1.intValue, targetBitCount) >> value2.intValue;
+    else value = value1.intValue >> value2.intValue;
+  } else if (op[0] == C('&')) {
+    value = value1.intValue & value2.intValue;
+  } else if (op[0] == C('|')) {
+    value = value1.intValue | value2.intValue;
+  } else {
+    value = value1.intValue ^ value2.intValue;
+  }
+  this->setIntResult(astType, value, result);
+  return true;
+}
+
+
+Bool ConstantFolder::foldComparisonOp(Char const *op, Constant &first, Constant &second, Constant &result)
+{
+  Int comparison;
+  if (first.isFloat || second.isFloat) {
+    Word bitCount = !second.isFloat || (first.isFloat && first.bitCount >= second.bitCount) ?
+      first.bitCount : second.bitCount;
+    Double value1 = this->getFloatValue(first, bitCount);
+    Double value2 = this->getFloatValue(second, bitCount);
+    // All float comparisons are ordered, so they are all false if either operand is NaN.
+    if (std::isnan(value1) || std::isnan(value2)) {
+      this->setIntResult(this->astHelper->getBoolType(), 0, result);
+      return true;
+    }
+    comparison = value1 < value2 ? -1 : value1 > value2 ? 1 : 0;
+  } else {
+    // Mirror the integer promotion rules of ExpressionGenerator::_generateComparisonOp.
+    auto targetBitCount = first.bitCount >= second.bitCount ? first.bitCount : second.bitCount;
+    Ast::IntegerType *astType;
+    if (!first.isSigned && !second.isSigned) {
+      astType = this->astHelper->getWordType(targetBitCount);
+    } else if (
+      (first.isSigned && second.isSigned) ||
+      (!first.isSigned && first.bitCount < second.bitCount) ||
+      (first.isSigned && first.bitCount > second.bitCount)
+    ) {
+      astType = this->astHelper->getIntType(targetBitCount);
+    } else {
+      return false;
+    }
+    Constant value1, value2;
+    if (!this->castToIntType(first, astType, value1) || !this->castToIntType(second, astType, value2)) return false;
+    if (astType->isSigned()) {
+      LongInt signed1 = signExtend(value1.intValue, targetBitCount);
+      LongInt signed2 = signExtend(value2.intValue, targetBitCount);
+      comparison = signed1 < signed2 ? -1 : signed1 > signed2 ? 1 : 0;
+    } else {
+      comparison = value1.intValue < value2.intValue ? -1 : value1.intValue > value2.intValue ? 1 : 0;
+    }
+  }
+
+  Bool value;
+  if (compareStr(op, S("==")) == 0) value = comparison == 0;
+  else if (compareStr(op, S("!=")) == 0) value = comparison != 0;
+  else if (compareStr(op, S(">")) == 0) value = comparison > 0;
+  else if (compareStr(op, S(">=")) == 0) value = comparison >= 0;
+  else if (compareStr(op, S("<")) == 0) value = comparison < 0;
+  else value = comparison <= 0;
+  this->setIntResult(this->astHelper->getBoolType(), value, result);
+  return true;
+}
+
+
+//==============================================================================
+// Literal Parsing Functions
+
+Ast::IntegerType* ConstantFolder::parseIntegerLiteral(
+  Core::Data::Ast::IntegerLiteral *astNode, LongWord &value, Word &size, Bool &signedNum
+) {
+  auto src = astNode->getValue().get();
+
+  // TODO: Consider non-English letters prefixes and postfixes in the literal.
+  // TODO: Implement unsigned integers.
+
+  // Parse the given value.
+  Int base = 10;
+  if (compareStr(src, S("0b"), 2) == 0 || compareStr(src, S("0B"), 2) == 0) {
+    base = 2;
+    src += 2;
+  } else if (compareStr(src, S("0ن"), 3) == 0) {
+    base = 2;
+    src += 3;
+  } else if (compareStr(src, S("0o"), 2) == 0 || compareStr(src, S("0O"), 2) == 0) {
+    base = 8;
+    src += 2;
+  } else if (compareStr(src, S("0م"), 3) == 0) {
+    base = 8;
+    src += 3;
+  } else if (
+    compareStr(src, S("0h"), 2) == 0 || compareStr(src, S("0H"), 2) == 0 ||
+    compareStr(src, S("0x"), 2) == 0 || compareStr(src, S("0X"), 2) == 0
+  ) {
+    base = 16;
+    src += 2;
+  }
+  value = 0;
+  while (
+    (*src >= C('0') && *src <= C('9')) ||
+    (*src >= C('a') && *src <= C('f')) ||
+    (*src >= C('A') && *src <= C('F'))
+  ) {
+    Int digit = 0;
+    if (*src >= C('0') && *src <= C('9')) digit = *src - C('0');
+    else if (*src >= C('a') && *src <= C('f')) digit = *src - C('a') + 10;
+    else if (*src >= C('A') && *src <= C('F')) digit = *src - C('A') + 10;
+    ASSERT(digit < base);
+    value *= base;
+    value += digit;
+    ++src;
+  }
+
+  // Is it a signed number?
+  signedNum = true;
+  if (*src == C('u') || *src == C('U')) {
+    signedNum = false;
+    ++src;
+  } else if (compareStr(src, S("ط"), 2) == 0) {
+    signedNum = false;
+    src += 2;
+  }
+
+  // Determine integer size.
+  Bool typeRequested = false;
+  if (*src == C('i') || *src == C('I')) {
+    typeRequested = true;
+    ++src;
+    if (getStrLen(src) > 0) size = std::stoi(src);
+  } else if (compareStr(src, S("ص"), 2) == 0) {
+    typeRequested = true;
+    src += 2;
+    if (getStrLen(src) > 0) size = std::stoi(src);
+  } else {
+    if (value == 0 || value == 1) {
+      // Give special treatment to 0 and 1 and consider it unsigned.
+      signedNum = false;
+    }
+    size = signedNum ?
+      this->astHelper->getNeededIntSize((LongInt)value) :
+      this->astHelper->getNeededWordSize(value);
+  }
+
+  // Get the requested type.
+  if (!typeRequested && value == 0) {
+    return this->astHelper->getNullType();
+  } else if (signedNum) {
+    return this->astHelper->getIntType(size);
+  } else {
+    return this->astHelper->getWordType(size);
+  }
+}
+
+
+Ast::FloatType* ConstantFolder::parseFloatLiteral(
+  Core::Data::Ast::FloatLiteral *astNode, Double &value, Word &size
+) {
+  auto src = astNode->getValue().get();
+
+  // TODO: Consider non-English letters prefixes and postfixes in the literal.
+  // TODO: Consider the different float sizes.
+
+  // Parse the given value.
+  std::size_t numSize;
+  value = std::stof(src, &numSize);
+  src += numSize;
+
+  // Determine float size.
+  size = 32;
+  if (*src == C('f') || *src == C('F')) {
+    ++src;
+    if (getStrLen(src) > 0) size = std::stoi(src);
+  } else if (compareStr(src, S("ع"), 2) == 0) {
+    src += 2;
+    if (getStrLen(src) > 0) size = std::stoi(src);
+  }
+
+  // Get the requested float type.
+  return this->astHelper->getFloatType(size);
+}
+
+
+//==============================================================================
+// Helper Functions
+
+void ConstantFolder::setIntResult(Ast::IntegerType *astType, LongWord value, Constant &result)
+{
+  result.astType = astType;
+  result.bitCount = astType->getBitCount(this->astHelper, this->executionContext);
+  result.isFloat = false;
+  result.isSigned = astType->isSigned();
+  result.intValue = truncate(value, result.bitCount);
+  result.floatValue = 0;
+}
+
+
+void ConstantFolder::setFloatResult(Ast::FloatType *astType, Double value, Constant &result)
+{
+  result.astType = astType;
+  result.bitCount = astType->getBitCount(this->astHelper);
+  result.isFloat = true;
+  result.isSigned = true;
+  result.intValue = 0;
+  result.floatValue = result.bitCount == 32 ? (Double)(Float)value : value;
+}
+
+
+Bool ConstantFolder::castToIntType(Constant const &src, Ast::IntegerType *astType, Constant &result)
+{
+  if (src.isFloat) return false;
+  auto bitCount = astType->getBitCount(this->astHelper, this->executionContext);
+  if (bitCount > 64) return false;
+  // Integer casts extend according to the signedness of the source.
+  LongWord value = src.isSigned ? (LongWord)signExtend(src.intValue, src.bitCount) : src.intValue;
+  this->setIntResult(astType, value, result);
+  return true;
+}
+
+
+Double ConstantFolder::getFloatValue(Constant const &src, Word bitCount)
+{
+  if (src.isFloat) {
+    return bitCount == 32 ? (Double)(Float)src.floatValue : src.floatValue;
+  } else if (src.isSigned) {
+    LongInt value = signExtend(src.intValue, src.bitCount);
+    return bitCount == 32 ? (Double)(Float)value : (Double)value;
+  } else {
+    return bitCount == 32 ? (Double)(Float)src.intValue : (Double)src.intValue;
+  }
+}
+
+} // namespace
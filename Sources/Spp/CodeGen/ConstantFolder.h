@@ -0,0 +1,121 @@
+/**
+ * @file Spp/CodeGen/ConstantFolder.h
+ * Contains the header of class Spp::CodeGen::ConstantFolder.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_CODEGEN_CONSTANTFOLDER_H
+#define SPP_CODEGEN_CONSTANTFOLDER_H
+
+namespace Spp::CodeGen
+{
+
+/**
+ * @brief Evaluates constant expressions at the AST level.
+ * @ingroup spp_codegen
+ *
+ * Folds operators whose operands are all literals into a single constant,
+ * following the same type promotion rules used by ExpressionGenerator, and
+ * wrapping integer results to the width of their result type. Operations
+ * whose result is undefined at run time (division by zero, signed division
+ * overflow, and out of range shifts) are not folded, and neither are
+ * operators with operands of unsupported types.
+ */
+class ConstantFolder
+{
+  //============================================================================
+  // Types
+
+  public: struct Constant
+  {
+    Ast::Type *astType = 0;
+    Word bitCount = 0;
+    Bool isFloat = false;
+    Bool isSigned = false;
+    // Integer values are kept truncated to bitCount bits.
+    LongWord intValue = 0;
+    Double floatValue = 0;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Ast::Helper *astHelper;
+  private: ExecutionContext const *executionContext;
+  private: Bool resolvingIdentifiers;
+
+
+  //============================================================================
+  // Constructor
+
+  public: ConstantFolder(Ast::Helper *h, ExecutionContext const *ec, Bool ri = false)
+    : astHelper(h), executionContext(ec), resolvingIdentifiers(ri)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Folding Functions
+  /// @{
+
+  /// Folds the given expression into a constant, if possible.
+  public: Bool fold(TiObject *astNode, Constant &result);
+
+  /// Folds the given condition into a boolean constant, if possible.
+  public: Bool foldCondition(TiObject *astNode, Bool &result);
+
+  private: Bool isFoldable(TiObject *astNode);
+  private: Bool foldNode(TiObject *astNode, Constant &result);
+  private: Bool foldInfixOp(Core::Data::Ast::InfixOperator *astNode, Constant &result);
+  private: Bool foldPrefixOp(Core::Data::Ast::PrefixOperator *astNode, Constant &result);
+  private: Bool foldArithmeticOp(Char const *op, Constant &first, Constant &second, Constant &result);
+  private: Bool foldBinaryOp(Char const *op, Constant &first, Constant &second, Constant &result);
+  private: Bool foldComparisonOp(Char const *op, Constant &first, Constant &second, Constant &result);
+
+  /// @}
+
+  /// @name Literal Parsing Functions
+  /// @{
+
+  public: Ast::IntegerType* parseIntegerLiteral(
+    Core::Data::Ast::IntegerLiteral *astNode, LongWord &value, Word &size, Bool &signedNum
+  );
+
+  public: Ast::FloatType* parseFloatLiteral(Core::Data::Ast::FloatLiteral *astNode, Double &value, Word &size);
+
+  /// @}
+
+  /// @name Helper Functions
+  /// @{
+
+  private: void setIntResult(Ast::IntegerType *astType, LongWord value, Constant &result);
+  private: void setFloatResult(Ast::FloatType *astType, Double value, Constant &result);
+  private: Bool castToIntType(Constant const &src, Ast::IntegerType *astType, Constant &result);
+  private: Double getFloatValue(Constant const &src, Word bitCount);
+
+  public: static LongWord truncate(LongWord value, Word bitCount)
+  {
+    return bitCount >= 64 ? value : value & ((1ull << bitCount) - 1);
+  }
+
+  public: static LongInt signExtend(LongWord value, Word bitCount)
+  {
+    return bitCount >= 64 ? (LongInt)value : (LongInt)(value << (64 - bitCount)) >> (64 - bitCount);
+  }
+
+  /// @}
+
+}; // class
+
+} // namespace
+
+#endif
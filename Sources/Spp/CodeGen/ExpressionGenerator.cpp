@@ -52,6 +52,8 @@ void ExpressionGenerator::initBindingCaches()
     &this->generateInitOp,
     &this->generateTerminateOp,
     &this->generateNextArgOp,
+    &this->generateAtomicOp,
+    &this->generateVectorOp,
     &this->generateStringLiteral,
     &this->generateCharLiteral,
     &this->generateIntegerLiteral,
@@ -102,6 +104,8 @@ void ExpressionGenerator::initBindings()
   this->generateInitOp = &ExpressionGenerator::_generateInitOp;
   this->generateTerminateOp = &ExpressionGenerator::_generateTerminateOp;
   this->generateNextArgOp = &ExpressionGenerator::_generateNextArgOp;
+  this->generateAtomicOp = &ExpressionGenerator::_generateAtomicOp;
+  this->generateVectorOp = &ExpressionGenerator::_generateVectorOp;
   this->generateStringLiteral = &ExpressionGenerator::_generateStringLiteral;
   this->generateCharLiteral = &ExpressionGenerator::_generateCharLiteral;
   this->generateIntegerLiteral = &ExpressionGenerator::_generateIntegerLiteral;
@@ -176,6 +180,12 @@ Bool ExpressionGenerator::_generate(
   } else if (astNode->isDerivedFrom<Spp::Ast::NextArgOp>()) {
     auto nextArgOp = static_cast<Spp::Ast::NextArgOp*>(astNode);
     return expGenerator->generateNextArgOp(nextArgOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::AtomicOp>()) {
+    auto atomicOp = static_cast<Spp::Ast::AtomicOp*>(astNode);
+    return expGenerator->generateAtomicOp(atomicOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::VectorOp>()) {
+    auto vectorOp = static_cast<Spp::Ast::VectorOp*>(astNode);
+    return expGenerator->generateVectorOp(vectorOp, g, session, result);
   } else if (astNode->isDerivedFrom<Core::Data::Ast::StringLiteral>()) {
     auto stringLiteral = static_cast<Core::Data::Ast::StringLiteral*>(astNode);
     return expGenerator->generateStringLiteral(stringLiteral, g, session, result);
@@ -658,8 +668,10 @@ Bool ExpressionGenerator::_generateRoundParamPassOnCallee(
       }
       result.astType = astFuncType->traceRetType(expGenerator->astHelper);
       return true;
-    } else if (contentType != 0 && contentType->isDerivedFrom<Ast::ArrayType>()) {
-      //// Reference array element.
+    } else if (
+      contentType != 0 && (contentType->isDerivedFrom<Ast::ArrayType>() || contentType->isDerivedFrom<Ast::VectorType>())
+    ) {
+      //// Reference array or vector element.
       ////
       // Get a reference to the array.
       GenResult derefCallee;
@@ -709,6 +721,12 @@ Bool ExpressionGenerator::_generateOperator(
 ) {
   PREPARE_SELF(expGenerator, ExpressionGenerator);
 
+  // Fold operators whose operands are all literals into a single literal.
+  ConstantFolder::Constant constant;
+  if (ConstantFolder(expGenerator->astHelper, session->getExecutionContext()).fold(astNode, constant)) {
+    return expGenerator->generateConstant(astNode, constant, g, session, result);
+  }
+
   s_enum(OpType,
     INVALID, ASSIGN, ARITHMETIC, BINARY, COMPARISON, ARITHMETIC_ASSIGN, BINARY_ASSIGN,
     UNARY_VAL, INT_UNARY_VAL, UNARY_VAR
@@ -964,8 +982,14 @@ Bool ExpressionGenerator::_generateArithmeticOp(
   )) return false;
   Ast::Type *astTargetType = 0;
   Ast::Type *astOp2CastType = 0;
+  auto astVectorType = expGenerator->getVectorOperandsType(param1.astType, param2.astType, session);
 
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (astVectorType != 0) {
+    // Vectors, or a vector and a scalar that gets splatted into a vector.
+    astOp2CastType = astTargetType = astVectorType;
+  } else if (
+    param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()
+  ) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -1100,8 +1124,17 @@ Bool ExpressionGenerator::_generateBinaryOp(
     static_cast<Ast::Type*>(paramAstTypes->get(1)), paramTgValues->getElement(1), true, false, session, param2
   )) return false;
   Ast::Type *astTargetType = 0;
+  auto astVectorType = expGenerator->getVectorOperandsType(param1.astType, param2.astType, session);
 
-  if (param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()) {
+  if (
+    astVectorType != 0 &&
+    astVectorType->getElementType(expGenerator->astHelper)->isDerivedFrom<Ast::IntegerType>()
+  ) {
+    // Integer vectors, or an integer vector and a scalar that gets splatted into a vector.
+    astTargetType = astVectorType;
+  } else if (
+    param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()
+  ) {
     // Two integers.
     auto integerType1 = static_cast<Ast::IntegerType*>(param1.astType);
     auto integerType2 = static_cast<Ast::IntegerType*>(param2.astType);
@@ -1207,8 +1240,14 @@ Bool ExpressionGenerator::_generateComparisonOp(
     static_cast<Ast::Type*>(paramAstTypes->get(1)), paramTgValues->getElement(1), true, false, session, param2
   )) return false;
   Ast::Type *astTargetType = 0;
+  auto astVectorType = expGenerator->getVectorOperandsType(param1.astType, param2.astType, session);
 
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (astVectorType != 0) {
+    // Vectors, or a vector and a scalar that gets splatted into a vector.
+    astTargetType = astVectorType;
+  } else if (
+    param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()
+  ) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -1285,13 +1324,22 @@ Bool ExpressionGenerator::_generateComparisonOp(
     throw EXCEPTION(GenericException, S("Unexpected error while generating arithmetic op result target type."));
   }
 
+  // Comparing vectors gives a vector of booleans.
+  Ast::Type *astResultType = expGenerator->astHelper->getBoolType();
+  if (astVectorType != 0) {
+    astResultType = expGenerator->astHelper->getVectorTypeFor(
+      astResultType, astVectorType->getSize(expGenerator->astHelper)
+    );
+    if (astResultType == 0) return false;
+  }
+
   if (astNode->getType() == S("==")) {
     if (session->getTgContext() != 0) {
       if (!session->getTg()->generateEqual(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("!=")) {
     if (session->getTgContext() != 0) {
@@ -1299,7 +1347,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">")) {
     if (session->getTgContext() != 0) {
@@ -1307,7 +1355,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">=")) {
     if (session->getTgContext() != 0) {
@@ -1315,7 +1363,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<")) {
     if (session->getTgContext() != 0) {
@@ -1323,7 +1371,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<=")) {
     if (session->getTgContext() != 0) {
@@ -1331,7 +1379,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else {
     throw EXCEPTION(InvalidArgumentException, S("astNode"), S("Does not represent a comparison operator."));
@@ -1567,6 +1615,8 @@ Bool ExpressionGenerator::_generateUnaryValOp(
   Ast::Type *astTargetType = 0;
   if (param.astType->isDerivedFrom<Ast::FloatType>()) {
     astTargetType = static_cast<Ast::FloatType*>(param.astType);
+  } else if (param.astType->isDerivedFrom<Ast::VectorType>()) {
+    astTargetType = param.astType;
   } else if (param.astType->isDerivedFrom<Ast::IntegerType>()) {
     auto integerType = static_cast<Ast::IntegerType*>(param.astType);
     auto bitCount = integerType->getBitCount(expGenerator->astHelper, session->getExecutionContext());
@@ -2291,6 +2341,315 @@ Bool ExpressionGenerator::_generateNextArgOp(
 }
 
 
+Bool ExpressionGenerator::_generateAtomicOp(
+  TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  // Generate the operand.
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("AtomicOp operand is missing."));
+  }
+  GenResult operandResult;
+  if (!expGenerator->generate(operand, g, session, operandResult)) return false;
+  if (operandResult.astType == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+
+  // Dereference and get content type.
+  GenResult target;
+  if (!expGenerator->dereferenceIfNeeded(
+    static_cast<Ast::Type*>(operandResult.astType), operandResult.targetData.get(), false, false, session, target
+  )) return false;
+  auto astRefType = ti_cast<Ast::ReferenceType>(target.astType);
+  if (astRefType == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  Ast::Type *astContentType = astRefType->getContentType(expGenerator->astHelper);
+
+  // Only integers can be used in arithmetic and bitwise operations, while pointers can also be loaded, stored, and
+  // exchanged. Integers need to be of a size that the target can access atomically.
+  auto const &operation = astNode->getOperation();
+  Bool integerOnly = operation != S("load") && operation != S("store") && operation != S("xchg") &&
+    operation != S("cas");
+  Bool validType;
+  if (astContentType->isDerivedFrom<Ast::IntegerType>()) {
+    auto bitCount = static_cast<Ast::IntegerType*>(astContentType)->getBitCount(
+      expGenerator->astHelper, session->getExecutionContext()
+    );
+    validType = bitCount == 8 || bitCount == 16 || bitCount == 32 || bitCount == 64;
+  } else {
+    validType = !integerOnly && astContentType->isDerivedFrom<Ast::PointerType>();
+  }
+  if (!validType) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+
+  // Separate the trailing memory orderings from the args. cas can have two orderings, one for when the exchange
+  // happens and one for when it fails.
+  PlainList<TiObject> argAstNodes;
+  auto param = astNode->getParam().get();
+  auto paramList = ti_cast<Core::Data::Ast::List>(param);
+  if (paramList != 0) {
+    for (Int i = 0; i < paramList->getElementCount(); ++i) argAstNodes.add(paramList->getElement(i));
+  } else if (param != 0) {
+    argAstNodes.add(param);
+  }
+  Int maxOrderingCount = operation == S("cas") ? 2 : 1;
+  Int orderingCount = 0;
+  Int ordering;
+  while (
+    orderingCount < maxOrderingCount && argAstNodes.getCount() > orderingCount &&
+    getAtomicOrdering(argAstNodes.get(argAstNodes.getCount() - orderingCount - 1), ordering)
+  ) {
+    ++orderingCount;
+  }
+  Int successOrdering = AtomicOrdering::SEQ_CST;
+  Int failureOrdering = AtomicOrdering::SEQ_CST;
+  if (orderingCount > 0) {
+    getAtomicOrdering(argAstNodes.get(argAstNodes.getCount() - orderingCount), successOrdering);
+    if (orderingCount > 1) {
+      getAtomicOrdering(argAstNodes.get(argAstNodes.getCount() - 1), failureOrdering);
+    } else {
+      // A failed cas doesn't write, so it takes the success ordering without the release part.
+      if (successOrdering == AtomicOrdering::ACQ_REL) failureOrdering = AtomicOrdering::ACQUIRE;
+      else if (successOrdering == AtomicOrdering::RELEASE) failureOrdering = AtomicOrdering::RELAXED;
+      else failureOrdering = successOrdering;
+    }
+    for (Int i = 0; i < orderingCount; ++i) argAstNodes.remove(argAstNodes.getCount() - 1);
+  }
+  Bool validOrdering;
+  if (operation == S("load")) {
+    validOrdering = successOrdering != AtomicOrdering::RELEASE && successOrdering != AtomicOrdering::ACQ_REL;
+  } else if (operation == S("store")) {
+    validOrdering = successOrdering != AtomicOrdering::ACQUIRE && successOrdering != AtomicOrdering::ACQ_REL;
+  } else if (operation == S("cas")) {
+    // The failure ordering can't release and can't be stronger than the success ordering.
+    validOrdering = failureOrdering != AtomicOrdering::RELEASE && failureOrdering != AtomicOrdering::ACQ_REL && (
+      failureOrdering == AtomicOrdering::RELAXED || successOrdering == AtomicOrdering::SEQ_CST ||
+      (failureOrdering == AtomicOrdering::ACQUIRE && successOrdering != AtomicOrdering::RELEASE &&
+        successOrdering != AtomicOrdering::RELAXED)
+    );
+  } else {
+    validOrdering = true;
+  }
+  if (!validOrdering) {
+    expGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidAtomicOrderingNotice>(astNode->getSourceLocation()));
+    return false;
+  }
+
+  // Prepare the args, casting them to the type of the variable.
+  SharedList<TiObject> paramTgValues;
+  PlainList<TiObject> paramAstTypes;
+  PlainList<TiObject> paramAstNodes;
+  for (Int i = 0; i < argAstNodes.getCount(); ++i) {
+    if (!expGenerator->generateParams(
+      argAstNodes.get(i), g, session, &paramAstNodes, &paramAstTypes, &paramTgValues
+    )) return false;
+  }
+  Int argCount = operation == S("load") ? 0 : operation == S("cas") ? 2 : 1;
+  if (paramAstTypes.getCount() != argCount) {
+    expGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidAtomicArgsNotice>(astNode->getSourceLocation()));
+    return false;
+  }
+  SharedList<TiObject> argTgValues;
+  for (Int i = 0; i < argCount; ++i) {
+    auto paramAstType = static_cast<Ast::Type*>(paramAstTypes.get(i));
+    GenResult castResult;
+    Bool retVal;
+    if (session->getTgContext() != 0) {
+      retVal = g->generateCast(
+        session, paramAstType, astContentType, astNode, paramTgValues.getElement(i), true, castResult
+      );
+    } else {
+      retVal = expGenerator->astHelper->isImplicitlyCastableTo(
+        paramAstType, astContentType, session->getExecutionContext()
+      );
+    }
+    if (!retVal) {
+      expGenerator->noticeStore->add(
+        newSrdObj<Spp::Notices::InvalidAtomicArgsNotice>(astNode->getSourceLocation())
+      );
+      return false;
+    }
+    argTgValues.add(castResult.targetData);
+  }
+
+  TiObject *tgContentType;
+  if (!g->getGeneratedType(astContentType, session, tgContentType, 0)) return false;
+
+  // Generate the operation.
+  if (session->getTgContext() != 0) {
+    auto tg = session->getTg();
+    auto tgContext = session->getTgContext();
+    auto tgVar = target.targetData.get();
+    Bool retVal;
+    if (operation == S("load")) {
+      retVal = tg->generateAtomicLoad(tgContext, tgContentType, successOrdering, tgVar, result.targetData);
+    } else if (operation == S("store")) {
+      retVal = tg->generateAtomicStore(
+        tgContext, tgContentType, successOrdering, tgVar, argTgValues.getElement(0), result.targetData
+      );
+    } else if (operation == S("cas")) {
+      retVal = tg->generateAtomicCmpXchg(
+        tgContext, tgContentType, successOrdering, failureOrdering, tgVar, argTgValues.getElement(0),
+        argTgValues.getElement(1), result.targetData
+      );
+    } else {
+      Int op;
+      if (operation == S("add")) op = AtomicRmwOp::ADD;
+      else if (operation == S("sub")) op = AtomicRmwOp::SUB;
+      else if (operation == S("xchg")) op = AtomicRmwOp::XCHG;
+      else if (operation == S("and")) op = AtomicRmwOp::AND;
+      else if (operation == S("or")) op = AtomicRmwOp::OR;
+      else if (operation == S("xor")) op = AtomicRmwOp::XOR;
+      else if (operation == S("max")) op = AtomicRmwOp::MAX;
+      else if (operation == S("min")) op = AtomicRmwOp::MIN;
+      else throw EXCEPTION(GenericException, S("Unexpected atomic operation."));
+      retVal = tg->generateAtomicRmw(
+        tgContext, tgContentType, op, successOrdering, tgVar, argTgValues.getElement(0), result.targetData
+      );
+    }
+    if (!retVal) return false;
+  }
+  // All operations except store return the value the variable had before the operation.
+  if (operation == S("store")) result.astType = expGenerator->astHelper->getVoidType();
+  else result.astType = astContentType;
+  return true;
+}
+
+
+Bool ExpressionGenerator::_generateVectorOp(
+  TiObject *self, Spp::Ast::VectorOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  // Generate the operand.
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("VectorOp operand is missing."));
+  }
+  GenResult operandResult;
+  if (!expGenerator->generate(operand, g, session, operandResult)) return false;
+  if (operandResult.astType == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidVectorOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  GenResult target;
+  if (!expGenerator->dereferenceIfNeeded(
+    static_cast<Ast::Type*>(operandResult.astType), operandResult.targetData.get(), true, false, session, target
+  )) return false;
+  auto astVectorType = ti_cast<Ast::VectorType>(target.astType);
+  if (astVectorType == 0) {
+    expGenerator->noticeStore->add(
+      newSrdObj<Spp::Notices::InvalidVectorOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  auto astElementType = astVectorType->getElementType(expGenerator->astHelper);
+  auto size = astVectorType->getSize(expGenerator->astHelper);
+
+  TiObject *tgVectorType;
+  if (!g->getGeneratedType(astVectorType, session, tgVectorType, 0)) return false;
+
+  SharedList<TiObject> paramTgValues;
+  PlainList<TiObject> paramAstTypes;
+  PlainList<TiObject> paramAstNodes;
+  if (!expGenerator->generateParams(
+    astNode->getParam().get(), g, session, &paramAstNodes, &paramAstTypes, &paramTgValues
+  )) return false;
+
+  auto const &operation = astNode->getOperation();
+  if (operation == S("shuffle")) {
+    // The first arg is the second vector to pick elements from, and the rest are the indexes of the picked elements,
+    // where indexes beyond the size of the vector refer to elements of the second vector.
+    if (paramAstTypes.getCount() < 2) {
+      expGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidVectorArgsNotice>(astNode->getSourceLocation()));
+      return false;
+    }
+    GenResult castResult;
+    Bool retVal;
+    if (session->getTgContext() != 0) {
+      retVal = g->generateCast(
+        session, static_cast<Ast::Type*>(paramAstTypes.get(0)), astVectorType, astNode, paramTgValues.getElement(0),
+        true, castResult
+      );
+    } else {
+      retVal = expGenerator->astHelper->isImplicitlyCastableTo(
+        static_cast<Ast::Type*>(paramAstTypes.get(0)), astVectorType, session->getExecutionContext()
+      );
+    }
+    if (!retVal) {
+      expGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidVectorArgsNotice>(astNode->getSourceLocation()));
+      return false;
+    }
+    std::vector<Int> mask;
+    for (Int i = 1; i < paramAstNodes.getCount(); ++i) {
+      auto literal = ti_cast<Core::Data::Ast::IntegerLiteral>(paramAstNodes.get(i));
+      Int index = literal == 0 ? -1 : std::stol(literal->getValue().get());
+      if (index < 0 || index >= (Int)size * 2) {
+        expGenerator->noticeStore->add(
+          newSrdObj<Spp::Notices::InvalidVectorArgsNotice>(Core::Data::Ast::findSourceLocation(paramAstNodes.get(i)))
+        );
+        return false;
+      }
+      mask.push_back(index);
+    }
+    auto astResultType = expGenerator->astHelper->getVectorTypeFor(astElementType, mask.size());
+    if (astResultType == 0) return false;
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateVectorShuffle(
+        session->getTgContext(), tgVectorType, target.targetData.get(), castResult.targetData.get(), mask,
+        result.targetData
+      )) return false;
+    }
+    result.astType = astResultType;
+    return true;
+  } else {
+    if (paramAstTypes.getCount() != 0) {
+      expGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidVectorArgsNotice>(astNode->getSourceLocation()));
+      return false;
+    }
+    Int op;
+    if (operation == S("reduce_add")) op = VectorReduceOp::ADD;
+    else if (operation == S("reduce_mul")) op = VectorReduceOp::MUL;
+    else if (operation == S("reduce_min")) op = VectorReduceOp::MIN;
+    else if (operation == S("reduce_max")) op = VectorReduceOp::MAX;
+    else if (operation == S("reduce_and")) op = VectorReduceOp::AND;
+    else if (operation == S("reduce_or")) op = VectorReduceOp::OR;
+    else throw EXCEPTION(GenericException, S("Unexpected vector operation."));
+    // Bitwise reductions only apply to integers.
+    if (
+      (op == VectorReduceOp::AND || op == VectorReduceOp::OR) && !astElementType->isDerivedFrom<Ast::IntegerType>()
+    ) {
+      expGenerator->noticeStore->add(
+        newSrdObj<Spp::Notices::InvalidVectorOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+      );
+      return false;
+    }
+    if (session->getTgContext() != 0) {
+      if (!session->getTg()->generateVectorReduce(
+        session->getTgContext(), tgVectorType, op, target.targetData.get(), result.targetData
+      )) return false;
+    }
+    result.astType = astElementType;
+    return true;
+  }
+}
+
+
 Bool ExpressionGenerator::_generateStringLiteral(
   TiObject *self, Core::Data::Ast::StringLiteral *astNode, Generation *g, Session *session, GenResult &result
 ) {
@@ -2348,88 +2707,13 @@ Bool ExpressionGenerator::_generateIntegerLiteral(
 ) {
   PREPARE_SELF(expGenerator, ExpressionGenerator);
 
-  auto src = astNode->getValue().get();
-
-  // TODO: Consider non-English letters prefixes and postfixes in the literal.
-  // TODO: Implement unsigned integers.
-
   // Parse the given value.
-  Int base = 10;
-  if (compareStr(src, S("0b"), 2) == 0 || compareStr(src, S("0B"), 2) == 0) {
-    base = 2;
-    src += 2;
-  } else if (compareStr(src, S("0ن"), 3) == 0) {
-    base = 2;
-    src += 3;
-  } else if (compareStr(src, S("0o"), 2) == 0 || compareStr(src, S("0O"), 2) == 0) {
-    base = 8;
-    src += 2;
-  } else if (compareStr(src, S("0م"), 3) == 0) {
-    base = 8;
-    src += 3;
-  } else if (
-    compareStr(src, S("0h"), 2) == 0 || compareStr(src, S("0H"), 2) == 0 ||
-    compareStr(src, S("0x"), 2) == 0 || compareStr(src, S("0X"), 2) == 0
-  ) {
-    base = 16;
-    src += 2;
-  }
-  LongWord value = 0;
-  while (
-    (*src >= C('0') && *src <= C('9')) ||
-    (*src >= C('a') && *src <= C('f')) ||
-    (*src >= C('A') && *src <= C('F'))
-  ) {
-    Int digit = 0;
-    if (*src >= C('0') && *src <= C('9')) digit = *src - C('0');
-    else if (*src >= C('a') && *src <= C('f')) digit = *src - C('a') + 10;
-    else if (*src >= C('A') && *src <= C('F')) digit = *src - C('A') + 10;
-    ASSERT(digit < base);
-    value *= base;
-    value += digit;
-    ++src;
-  }
-
-  // Is it a signed number?
-  Bool signedNum = true;
-  if (*src == C('u') || *src == C('U')) {
-    signedNum = false;
-    ++src;
-  } else if (compareStr(src, S("ط"), 2) == 0) {
-    signedNum = false;
-    src += 2;
-  }
-
-  // Determine integer size.
-  Bool typeRequested = false;
-  Int size;
-  if (*src == C('i') || *src == C('I')) {
-    typeRequested = true;
-    ++src;
-    if (getStrLen(src) > 0) size = std::stoi(src);
-  } else if (compareStr(src, S("ص"), 2) == 0) {
-    typeRequested = true;
-    src += 2;
-    if (getStrLen(src) > 0) size = std::stoi(src);
-  } else {
-    if (value == 0 || value == 1) {
-      // Give special treatment to 0 and 1 and consider it unsigned.
-      signedNum = false;
-    }
-    size = signedNum ?
-      expGenerator->astHelper->getNeededIntSize((LongInt)value) :
-      expGenerator->astHelper->getNeededWordSize(value);
-  }
-
-  // Get the requested type.
-  Ast::Type *astType;
-  if (!typeRequested && value == 0) {
-    astType = expGenerator->astHelper->getNullType();
-  } else if (signedNum) {
-    astType = expGenerator->astHelper->getIntType(size);
-  } else {
-    astType = expGenerator->astHelper->getWordType(size);
-  }
+  LongWord value;
+  Word size;
+  Bool signedNum;
+  Ast::Type *astType = ConstantFolder(expGenerator->astHelper, session->getExecutionContext()).parseIntegerLiteral(
+    astNode, value, size, signedNum
+  );
   auto sourceLocation = astNode->findSourceLocation().get();
   expGenerator->noticeStore->pushPrefixSourceLocation(sourceLocation);
   TiObject *intTgType;
@@ -2455,28 +2739,12 @@ Bool ExpressionGenerator::_generateFloatLiteral(
 ) {
   PREPARE_SELF(expGenerator, ExpressionGenerator);
 
-  auto src = astNode->getValue().get();
-
-  // TODO: Consider non-English letters prefixes and postfixes in the literal.
-  // TODO: Consider the different float sizes.
-
   // Parse the given value.
-  std::size_t numSize;
-  Double value = std::stof(src, &numSize);
-  src += numSize;
-
-  // Determine float size.
-  Int size = 32;
-  if (*src == C('f') || *src == C('F')) {
-    ++src;
-    if (getStrLen(src) > 0) size = std::stoi(src);
-  } else if (compareStr(src, S("ع"), 2) == 0) {
-    src += 2;
-    if (getStrLen(src) > 0) size = std::stoi(src);
-  }
-
-  // Get the requested float type.
-  auto floatAstType = expGenerator->astHelper->getFloatType(size);
+  Double value;
+  Word size;
+  auto floatAstType = ConstantFolder(expGenerator->astHelper, session->getExecutionContext()).parseFloatLiteral(
+    astNode, value, size
+  );
   auto sourceLocation = astNode->findSourceLocation().get();
   expGenerator->noticeStore->pushPrefixSourceLocation(sourceLocation);
   TiObject *floatTgType;
@@ -2672,13 +2940,27 @@ Bool ExpressionGenerator::_generateArrayReference(
     auto astPtrType = expGenerator->astHelper->getPointerTypeFor(astType);
     if (!g->getGeneratedType(astPtrType, session, tgArrayType, 0)) return false;
   }
-  auto astArrayType = ti_cast<Ast::ArrayType>(astType);
-  if (astArrayType == 0) {
-    throw EXCEPTION(GenericException, S("Unexpected type for array reference."));
-  }
 
   // Find element type.
-  auto astElementType = astArrayType->getContentType(expGenerator->astHelper);
+  Ast::Type *astElementType;
+  if (astType->isDerivedFrom<Ast::ArrayType>()) {
+    astElementType = static_cast<Ast::ArrayType*>(astType)->getContentType(expGenerator->astHelper);
+  } else if (astType->isDerivedFrom<Ast::VectorType>()) {
+    astElementType = static_cast<Ast::VectorType*>(astType)->getElementType(expGenerator->astHelper);
+    // Boolean elements are packed into bits, so they can't be referenced individually.
+    auto astIntElementType = ti_cast<Ast::IntegerType>(astElementType);
+    if (
+      astIntElementType != 0 &&
+      astIntElementType->getBitCount(expGenerator->astHelper, session->getExecutionContext()) == 1
+    ) {
+      expGenerator->noticeStore->add(
+        newSrdObj<Spp::Notices::InvalidVectorOperandNotice>(Core::Data::Ast::findSourceLocation(astNode))
+      );
+      return false;
+    }
+  } else {
+    throw EXCEPTION(GenericException, S("Unexpected type for array reference."));
+  }
   TiObject *tgElementType;
   if (!g->getGeneratedType(astElementType, session, tgElementType, 0)) return false;
 
@@ -2994,4 +3276,52 @@ Bool ExpressionGenerator::castLogicalOperand(
   return true;
 }
 
+
+Spp::Ast::VectorType* ExpressionGenerator::getVectorOperandsType(
+  Spp::Ast::Type *astType1, Spp::Ast::Type *astType2, Session *session
+) {
+  auto vectorType1 = ti_cast<Spp::Ast::VectorType>(astType1);
+  auto vectorType2 = ti_cast<Spp::Ast::VectorType>(astType2);
+  auto ec = session->getExecutionContext();
+  if (vectorType1 != 0 && vectorType2 != 0) {
+    // Element-wise ops need both vectors to be of the same type.
+    if (vectorType1->isEqual(vectorType2, this->astHelper, ec)) return vectorType1;
+  } else if (vectorType1 != 0) {
+    if (this->astHelper->isImplicitlyCastableTo(astType2, vectorType1, ec)) return vectorType1;
+  } else if (vectorType2 != 0) {
+    if (this->astHelper->isImplicitlyCastableTo(astType1, vectorType2, ec)) return vectorType2;
+  }
+  return 0;
+}
+
+
+Bool ExpressionGenerator::generateConstant(
+  Core::Data::Node *astNode, ConstantFolder::Constant const &constant, Generation *g, Session *session,
+  GenResult &result
+) {
+  auto sourceLocation = Core::Data::Ast::findSourceLocation(astNode).get();
+  this->noticeStore->pushPrefixSourceLocation(sourceLocation);
+  TiObject *tgType;
+  Bool retVal = g->getGeneratedType(constant.astType, session, tgType, 0);
+  this->noticeStore->popPrefixSourceLocation(Core::Data::getSourceLocationRecordCount(sourceLocation));
+  if (!retVal) return false;
+
+  if (session->getTgContext() != 0) {
+    if (constant.isFloat) {
+      if (!session->getTg()->generateFloatLiteral(
+        session->getTgContext(), constant.bitCount, constant.floatValue, result.targetData
+      )) return false;
+    } else {
+      LongInt value = constant.isSigned ?
+        ConstantFolder::signExtend(constant.intValue, constant.bitCount) :
+        (LongInt)constant.intValue;
+      if (!session->getTg()->generateIntLiteral(
+        session->getTgContext(), constant.bitCount, constant.isSigned, value, result.targetData
+      )) return false;
+    }
+  }
+  result.astType = constant.astType;
+  return true;
+}
+
 } // namespace
@@ -437,6 +437,24 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *self, Spp::Ast::NextArgOp *astNode, Generation *g, Session *session, GenResult &result
   );
 
+  public: METHOD_BINDING_CACHE(generateAtomicOp,
+    Bool, (
+      Spp::Ast::AtomicOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateAtomicOp(
+    TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorOp,
+    Bool, (
+      Spp::Ast::VectorOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateVectorOp(
+    TiObject *self, Spp::Ast::VectorOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
   public: METHOD_BINDING_CACHE(generateStringLiteral,
     Bool, (
       Core::Data::Ast::StringLiteral* /* astNode */, Generation* /* g */,
@@ -601,6 +619,15 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *tgValue, TioSharedPtr &result
   );
 
+  private: Spp::Ast::VectorType* getVectorOperandsType(
+    Spp::Ast::Type *astType1, Spp::Ast::Type *astType2, Session *session
+  );
+
+  private: Bool generateConstant(
+    Core::Data::Node *astNode, ConstantFolder::Constant const &constant, Generation *g, Session *session,
+    GenResult &result
+  );
+
   /// @}
 
 }; // class
@@ -245,6 +245,22 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
     if (terminal != TerminalStatement::YES) {
       // Destruct function args first, then return.
       if (!generation->generateVarGroupDestruction(&childSession, 0)) return false;
+      if (!session->getTg()->generateReturn(
+        tgContext.get(), session->getEda()->getCodeGenData<TiObject>(astRetType), 0
+      )) {
+        return false;
+      }
+    }
+
+    // Turn directly returned recursive calls into tail calls.
+    Bool tailCallsGuaranteed;
+    if (!session->getTg()->markTailCalls(tgFunc, tailCallsGuaranteed)) return false;
+    auto def = ti_cast<Core::Data::Ast::Definition>(astFunc->getOwner());
+    if (!tailCallsGuaranteed && def != 0 && generator->astHelper->doesModifierExistOnDef(def, S("tailcall"))) {
+      generator->noticeStore->add(
+        newSrdObj<Spp::Notices::TailCallNotGuaranteedNotice>(astFunc->findSourceLocation())
+      );
+      return false;
     }
 
     // Finalize the body.
@@ -278,6 +294,21 @@ Bool Generator::_generateFunctionDecl(TiObject *self, Spp::Ast::Function *astFun
   TioSharedPtr tgFuncResult;
   if (!session->getTg()->generateFunctionDecl(name, tgFunctionType, tgFuncResult)) return false;
   session->getEda()->setCodeGenData(astFunc, tgFuncResult);
+  if (!generator->generateFunctionAttributes(astFunc, tgFuncResult.get(), session)) return false;
+
+  // Let the profiler show where the function is defined.
+  auto profiler = Core::Main::Profiler::getSingleton();
+  if (profiler->isEnabled()) {
+    auto sourceLocation = Core::Data::Ast::findSourceLocation(astFunc).get();
+    if (sourceLocation != 0 && !sourceLocation->isDerivedFrom<Core::Data::SourceLocationRecord>()) {
+      auto stack = static_cast<Core::Data::SourceLocationStack*>(sourceLocation);
+      sourceLocation = stack->getCount() > 0 ? stack->get(stack->getCount() - 1).get() : 0;
+    }
+    if (sourceLocation != 0) {
+      auto record = static_cast<Core::Data::SourceLocationRecord*>(sourceLocation);
+      profiler->setSymbolLocation(name.getBuf(), record->filename.getBuf(), record->line);
+    }
+  }
 
   // TODO: Do we need these attributes?
   // if (astFunc->getBody() == 0) {
@@ -683,6 +714,44 @@ Bool Generator::_generateVarInitialization(
       )) {
         return false;
       }
+    } else if (
+      varAstType->isDerivedFrom<Ast::VectorType>() &&
+      paramAstTypes->getCount() == static_cast<Ast::VectorType*>(varAstType)->getSize(generator->getAstHelper())
+    ) {
+      // Initialize vectors element by element.
+      auto elementAstType = static_cast<Ast::VectorType*>(varAstType)->getElementType(generator->getAstHelper());
+      TiObject *elementTgType;
+      if (!generation->getGeneratedType(elementAstType, session, elementTgType, 0)) return false;
+      TiObject *vectorPtrTgType;
+      if (!generation->getGeneratedType(
+        generator->getAstHelper()->getPointerTypeFor(varAstType), session, vectorPtrTgType, 0
+      )) return false;
+      for (Int i = 0; i < paramAstTypes->getCount(); ++i) {
+        auto paramAstType = generator->getAstHelper()->traceType(paramAstTypes->getElement(i));
+        ASSERT(paramAstType);
+        GenResult castedValue;
+        if (!generation->generateCast(
+          session, paramAstType, elementAstType, ti_cast<Core::Data::Node>(paramAstNodes->getElement(i)),
+          paramTgValues->getElement(i), true, castedValue)
+        ) {
+          generator->noticeStore->add(newSrdObj<Spp::Notices::TypeMissingMatchingInitOpNotice>(
+            Core::Data::Ast::findSourceLocation(paramAstNodes->getElement(i))
+          ));
+          return false;
+        }
+        TioSharedPtr tgIndex;
+        if (!session->getTg()->generateIntLiteral(
+          session->getTgContext(), session->getExecutionContext()->getPointerBitCount(), true, i, tgIndex
+        )) return false;
+        TioSharedPtr tgElementRef;
+        if (!session->getTg()->generateArrayElementReference(
+          session->getTgContext(), vectorPtrTgType, elementTgType, tgIndex.get(), tgVarRef, tgElementRef
+        )) return false;
+        TioSharedPtr assignTgRes;
+        if (!session->getTg()->generateAssign(
+          session->getTgContext(), elementTgType, castedValue.targetData.get(), tgElementRef.get(), assignTgRes
+        )) return false;
+      }
     } else if (paramAstTypes->getCount() > 0) {
       generator->noticeStore->add(newSrdObj<Spp::Notices::TypeMissingMatchingInitOpNotice>(
         Core::Data::Ast::findSourceLocation(astNode)
@@ -995,6 +1064,9 @@ Bool Generator::_generateStatement(
     terminal = TerminalStatement::YES;
     auto returnStatement = static_cast<Spp::Ast::ReturnStatement*>(astNode);
     retVal = generator->commandGenerator->generateReturnStatement(returnStatement, generation, session);
+  } else if (astNode->isDerivedFrom<Spp::Ast::AtomicFenceStatement>()) {
+    auto fenceStatement = static_cast<Spp::Ast::AtomicFenceStatement*>(astNode);
+    retVal = generator->commandGenerator->generateAtomicFenceStatement(fenceStatement, generation, session);
   } else if (astNode->isDerivedFrom<Core::Data::Ast::Bridge>()) {
     retVal = generator->astHelper->validateUseStatement(static_cast<Core::Data::Ast::Bridge*>(astNode));
   } else {
@@ -1069,4 +1141,67 @@ Str Generator::getTempVarName()
   return Str("#temp") + (LongInt)(this->tempVarIndex++);
 }
 
+
+Bool Generator::generateFunctionAttributes(Spp::Ast::Function *astFunc, TiObject *tgFunc, Session *session)
+{
+  auto def = ti_cast<Core::Data::Ast::Definition>(astFunc->getOwner());
+  if (def == 0 || def->getModifiers() == 0) return true;
+
+  // Translate the optimization hint modifiers into function attributes.
+  Int attributes = FunctionAttributes::NONE;
+  if (this->astHelper->doesModifierExistOnDef(def, S("inline"))) attributes |= FunctionAttributes::ALWAYS_INLINE;
+  if (this->astHelper->doesModifierExistOnDef(def, S("noinline"))) attributes |= FunctionAttributes::NO_INLINE;
+  if (this->astHelper->doesModifierExistOnDef(def, S("hot"))) attributes |= FunctionAttributes::HOT;
+  if (this->astHelper->doesModifierExistOnDef(def, S("cold"))) attributes |= FunctionAttributes::COLD;
+  if (this->astHelper->doesModifierExistOnDef(def, S("pure"))) attributes |= FunctionAttributes::READ_NONE;
+  if (this->astHelper->doesModifierExistOnDef(def, S("readonly"))) attributes |= FunctionAttributes::READ_ONLY;
+  if (
+    ((attributes & FunctionAttributes::ALWAYS_INLINE) && (attributes & FunctionAttributes::NO_INLINE)) ||
+    ((attributes & FunctionAttributes::HOT) && (attributes & FunctionAttributes::COLD)) ||
+    ((attributes & FunctionAttributes::READ_NONE) && (attributes & FunctionAttributes::READ_ONLY))
+  ) {
+    this->noticeStore->add(newSrdObj<Spp::Notices::ConflictingFunctionModifiersNotice>(def->findSourceLocation()));
+    return false;
+  }
+  if (attributes != FunctionAttributes::NONE) {
+    if (!session->getTg()->setFunctionAttributes(tgFunc, attributes)) return false;
+  }
+
+  // Mark the args listed in noalias modifiers, which can only be pointers.
+  auto modifiers = def->getModifiers().get();
+  auto argTypes = astFunc->getType()->getArgTypes().get();
+  for (Int i = 0; i < modifiers->getElementCount(); ++i) {
+    auto paramPass = ti_cast<Core::Data::Ast::ParamPass>(modifiers->getElement(i));
+    if (paramPass == 0 || paramPass->getType() != Core::Data::Ast::BracketType::SQUARE) continue;
+    auto operand = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+    if (operand == 0 || operand->getValue() != S("noalias")) continue;
+
+    PlainList<TiObject> argNames;
+    auto list = paramPass->getParam().ti_cast_get<Core::Data::Ast::List>();
+    if (list != 0) {
+      for (Int j = 0; j < list->getElementCount(); ++j) argNames.add(list->getElement(j));
+    } else {
+      argNames.add(paramPass->getParam().get());
+    }
+    for (Int j = 0; j < argNames.getElementCount(); ++j) {
+      auto argName = ti_cast<Core::Data::Ast::Identifier>(argNames.getElement(j));
+      Int index = -1;
+      if (argName != 0 && argTypes != 0) index = argTypes->findIndex(argName->getValue().get());
+      if (
+        index == -1 ||
+        argTypes->getElement(index)->isDerivedFrom<Spp::Ast::ArgPack>() ||
+        !astFunc->getType()->traceArgType(index, this->astHelper)->isDerivedFrom<Spp::Ast::PointerType>()
+      ) {
+        this->noticeStore->add(newSrdObj<Spp::Notices::InvalidNoAliasModifierNotice>(
+          Core::Data::Ast::findSourceLocation(paramPass)
+        ));
+        return false;
+      }
+      if (!session->getTg()->setFunctionArgNoAlias(tgFunc, argName->getValue().get())) return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace
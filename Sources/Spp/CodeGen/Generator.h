@@ -249,6 +249,8 @@ class Generator : public TiObject, public DynamicBinding, public DynamicInterfac
 
   private: Str getTempVarName();
 
+  private: Bool generateFunctionAttributes(Spp::Ast::Function *astFunc, TiObject *tgFunc, Session *session);
+
   /// @}
 
 }; // class
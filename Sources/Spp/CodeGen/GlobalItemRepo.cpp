@@ -20,18 +20,60 @@ namespace Spp::CodeGen
 
 GlobalItemRepo::~GlobalItemRepo()
 {
-  for (Int i = 0; i < this->map.getLength(); ++i) {
-    if (this->map.valAt(i).size != 0) free(this->map.valAt(i).ptr);
+  for (auto &entry : this->entries) {
+    if (entry.size != 0) free(entry.ptr);
   }
 }
 
 
 //==============================================================================
-// Member Function
+// Helper Functions
+
+Int GlobalItemRepo::findSlot(Char const *name, Word length, Word hash) const
+{
+  Word mask = this->slots.size() - 1;
+  Word slot = hash & mask;
+  while (true) {
+    Int index = this->slots[slot];
+    if (index == -1) return slot;
+    auto &entry = this->entries[index];
+    if (
+      entry.hash == hash && entry.name.getLength() == length && memcmp(entry.name.getBuf(), name, length) == 0
+    ) return slot;
+    slot = (slot + 1) & mask;
+  }
+}
+
+
+void GlobalItemRepo::growSlots()
+{
+  Word slotCount = this->slots.size() == 0 ? 64 : this->slots.size() * 2;
+  this->slots.assign(slotCount, -1);
+  Word mask = slotCount - 1;
+  for (Int i = 0; i < this->entries.size(); ++i) {
+    Word slot = this->entries[i].hash & mask;
+    while (this->slots[slot] != -1) slot = (slot + 1) & mask;
+    this->slots[slot] = i;
+  }
+}
+
+
+void GlobalItemRepo::addEntry(Char const *name, Word length, Word hash, Word size, void *ptr)
+{
+  if ((this->entries.size() + 1) * 2 > this->slots.size()) this->growSlots();
+  Int slot = this->findSlot(name, length, hash);
+  this->slots[slot] = this->entries.size();
+  this->entries.emplace_back(name, length, hash, size, ptr);
+}
+
+
+//==============================================================================
+// Item Functions
 
 void GlobalItemRepo::addItem(Char const *name, Word size, void *ptr)
 {
-  Int i = this->map.findPos(Str(true, name));
+  Word length = getStrLen(name);
+  Int i = this->findItem(name, length);
   if (i == -1) {
     void *ptrCopy = malloc(size);
     if (ptr == 0) {
@@ -39,9 +81,9 @@ void GlobalItemRepo::addItem(Char const *name, Word size, void *ptr)
     } else {
       memcpy(ptrCopy, ptr, size);
     }
-    this->map(name) = Entry(size, ptrCopy);
+    this->addEntry(name, length, GlobalItemRepo::hashName(name, length), size, ptrCopy);
   } else {
-    if (this->map.valAt(i).size != size) {
+    if (this->entries[i].size != size) {
       throw EXCEPTION(GenericException, S("An existing variable is found with a different size."));
     }
   }
@@ -50,9 +92,10 @@ void GlobalItemRepo::addItem(Char const *name, Word size, void *ptr)
 
 void GlobalItemRepo::addItem(Char const *name, void *ptr)
 {
-  Int i = this->map.findPos(Str(true, name));
+  Word length = getStrLen(name);
+  Int i = this->findItem(name, length);
   if (i == -1) {
-    this->map(name) = Entry(0, ptr);
+    this->addEntry(name, length, GlobalItemRepo::hashName(name, length), 0, ptr);
   } else {
     throw EXCEPTION(GenericException, S("An existing variable is found with a different size."));
   }
@@ -61,28 +104,44 @@ void GlobalItemRepo::addItem(Char const *name, void *ptr)
 
 Str const& GlobalItemRepo::getItemName(Int i) const
 {
-  if (i < 0 || i >= this->map.getLength()) {
+  if (i < 0 || i >= this->entries.size()) {
     throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
   }
-  return this->map.keyAt(i);
+  return this->entries[i].name;
 }
 
 
 Word GlobalItemRepo::getItemSize(Int i) const
 {
-  if (i < 0 || i >= this->map.getLength()) {
+  if (i < 0 || i >= this->entries.size()) {
     throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
   }
-  return this->map.valAt(i).size;
+  return this->entries[i].size;
 }
 
 
 void* GlobalItemRepo::getItemPtr(Int i) const
 {
-  if (i < 0 || i >= this->map.getLength()) {
+  if (i < 0 || i >= this->entries.size()) {
     throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
   }
-  return this->map.valAt(i).ptr;
+  return this->entries[i].ptr;
+}
+
+
+Word GlobalItemRepo::resolveItems(Char const *const *names, Word const *lengths, Word count, void **ptrs) const
+{
+  Word found = 0;
+  for (Word i = 0; i < count; ++i) {
+    Int index = this->findItem(names[i], lengths[i]);
+    if (index == -1) {
+      ptrs[i] = 0;
+    } else {
+      ptrs[i] = this->entries[index].ptr;
+      ++found;
+    }
+  }
+  return found;
 }
 
 } // namespace
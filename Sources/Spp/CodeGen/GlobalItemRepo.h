@@ -23,23 +23,34 @@ class GlobalItemRepo
 
   private: struct Entry
   {
+    Str name;
+    Word hash;
     Word size;
     void *ptr;
-    Entry(): size(0), ptr(0) {}
-    Entry(Word s, void *p): size(s), ptr(p) {}
+    Entry(): hash(0), size(0), ptr(0) {}
+    Entry(Char const *n, Word l, Word h, Word s, void *p): name(n, l), hash(h), size(s), ptr(p) {}
   };
 
 
   //============================================================================
   // Member Variables
 
-  private: Srl::Map<Str, Entry> map;
+  /// The items in their order of insertion.
+  private: std::vector<Entry> entries;
+
+  /**
+   * @brief Open addressing hash table of indexes into the entries array.
+   * Collisions are resolved with linear probing and the number of slots is
+   * always a power of two that's at least double the number of entries. Empty
+   * slots are set to -1.
+   */
+  private: std::vector<Int> slots;
 
 
   //============================================================================
   // Constructor
 
-  public: GlobalItemRepo() : map(true)
+  public: GlobalItemRepo()
   {
   }
 
@@ -49,12 +60,31 @@ class GlobalItemRepo
   //============================================================================
   // Member Functions
 
+  /// @name Helper Functions
+  /// @{
+
+  private: static Word hashName(Char const *name, Word length)
+  {
+    return std::hash<std::string_view>{}(std::string_view(name, length));
+  }
+
+  private: Int findSlot(Char const *name, Word length, Word hash) const;
+
+  private: void growSlots();
+
+  private: void addEntry(Char const *name, Word length, Word hash, Word size, void *ptr);
+
+  /// @}
+
+  /// @name Item Functions
+  /// @{
+
   public: void addItem(Char const *name, Word size, void *ptr = 0);
   public: void addItem(Char const *name, void *ptr);
 
   public: Word getItemCount() const
   {
-    return this->map.getLength();
+    return this->entries.size();
   }
 
   public: Str const& getItemName(Int i) const;
@@ -65,9 +95,27 @@ class GlobalItemRepo
 
   public: Int findItem(Char const *name) const
   {
-    return this->map.findPos(Str(true, name));
+    return this->findItem(name, getStrLen(name));
   }
 
+  public: Int findItem(Char const *name, Word length) const
+  {
+    if (this->slots.size() == 0) return -1;
+    return this->slots[this->findSlot(name, length, GlobalItemRepo::hashName(name, length))];
+  }
+
+  /**
+   * @brief Resolve the pointers of multiple items in one call.
+   * The names are not required to be null terminated. The pointer of each
+   * found item is written to the corresponding entry in ptrs while missing
+   * items get a null pointer.
+   *
+   * @return The number of items that were found.
+   */
+  public: Word resolveItems(Char const *const *names, Word const *lengths, Word count, void **ptrs) const;
+
+  /// @}
+
 }; // class
 
 } // namespace
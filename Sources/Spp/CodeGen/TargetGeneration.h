@@ -41,12 +41,16 @@ class TargetGeneration : public ObjTiInterface
       &this->generateFloatType,
       &this->generatePointerType,
       &this->generateArrayType,
+      &this->generateVectorType,
       &this->generateStructTypeDecl,
       &this->generateStructTypeBody,
       &this->getTypeAllocationSize,
       &this->generateFunctionType,
       &this->generateFunctionDecl,
+      &this->setFunctionAttributes,
+      &this->setFunctionArgNoAlias,
       &this->prepareFunctionBody,
+      &this->markTailCalls,
       &this->finishFunctionBody,
       &this->deleteFunction,
       &this->generateGlobalVariable,
@@ -66,6 +70,8 @@ class TargetGeneration : public ObjTiInterface
       &this->generateCastIntToPointer,
       &this->generateCastPointerToInt,
       &this->generateCastPointerToPointer,
+      &this->generateCastScalarToVector,
+      &this->generateCastVectorToVector,
       &this->generateVarReference,
       &this->generateMemberVarReference,
       &this->generateArrayElementReference,
@@ -100,6 +106,13 @@ class TargetGeneration : public ObjTiInterface
       &this->generateOrAssign,
       &this->generateXorAssign,
       &this->generateNextArg,
+      &this->generateAtomicLoad,
+      &this->generateAtomicStore,
+      &this->generateAtomicRmw,
+      &this->generateAtomicCmpXchg,
+      &this->generateAtomicFence,
+      &this->generateVectorShuffle,
+      &this->generateVectorReduce,
       &this->generateEqual,
       &this->generateNotEqual,
       &this->generateGreaterThan,
@@ -158,6 +171,10 @@ class TargetGeneration : public ObjTiInterface
     Bool, (TiObject* /* contentType */, Word /* size */, TioSharedPtr& /* type */)
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorType,
+    Bool, (TiObject* /* elementType */, Word /* size */, TioSharedPtr& /* type */)
+  );
+
   public: METHOD_BINDING_CACHE(generateStructTypeDecl,
     Bool, (
       Char const* /* name */, TioSharedPtr& /* type */
@@ -191,6 +208,14 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(setFunctionAttributes,
+    Bool, (TiObject* /* function */, Int /* attributes */)
+  );
+
+  public: METHOD_BINDING_CACHE(setFunctionArgNoAlias,
+    Bool, (TiObject* /* function */, Char const* /* argName */)
+  );
+
   public: METHOD_BINDING_CACHE(prepareFunctionBody,
     Bool, (
       TiObject* /* function */, TiObject* /* functionType */,
@@ -198,6 +223,10 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(markTailCalls,
+    Bool, (TiObject* /* function */, Bool& /* guaranteed */)
+  );
+
   public: METHOD_BINDING_CACHE(finishFunctionBody,
     Bool, (
       TiObject* /* function */, TiObject* /* functionType */,
@@ -312,6 +341,19 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateCastScalarToVector,
+    Bool, (
+      TiObject* /* context */, TiObject* /* destType */, TiObject* /* srcVal */, TioSharedPtr& /* destVal */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateCastVectorToVector,
+    Bool, (
+      TiObject* /* context */, TiObject* /* srcType */, TiObject* /* destType */,
+      TiObject* /* srcVal */, TioSharedPtr& /* destVal */
+    )
+  );
+
   /// @}
 
   /// @name Operation Generation Functions
@@ -561,6 +603,61 @@ class TargetGeneration : public ObjTiInterface
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateAtomicLoad,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Int /* ordering */, TiObject* /* srcVar */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicStore,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Int /* ordering */,
+      TiObject* /* destVar */, TiObject* /* srcVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicRmw,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Int /* op */, Int /* ordering */,
+      TiObject* /* destVar */, TiObject* /* srcVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicCmpXchg,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Int /* successOrdering */, Int /* failureOrdering */,
+      TiObject* /* destVar */, TiObject* /* cmpVal */, TiObject* /* newVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicFence,
+    Bool, (TiObject* /* context */, Int /* ordering */)
+  );
+
+  /// @}
+
+  /// @name Vector Ops Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateVectorShuffle,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal1 */, TiObject* /* srcVal2 */,
+      std::vector<Int> const& /* mask */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorReduce,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Int /* op */, TiObject* /* srcVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  /// @}
+
   /// @name Comparison Ops Generation Functions
   /// @{
 
@@ -29,6 +29,7 @@ void TypeGenerator::initBindingCaches()
     &this->generatePointerType,
     &this->generateReferenceType,
     &this->generateArrayType,
+    &this->generateVectorType,
     &this->generateUserType,
     &this->generateUserTypeMemberVars,
     &this->generateUserTypeAutoConstructor,
@@ -52,6 +53,7 @@ void TypeGenerator::initBindings()
   this->generatePointerType = &TypeGenerator::_generatePointerType;
   this->generateReferenceType = &TypeGenerator::_generateReferenceType;
   this->generateArrayType = &TypeGenerator::_generateArrayType;
+  this->generateVectorType = &TypeGenerator::_generateVectorType;
   this->generateUserType = &TypeGenerator::_generateUserType;
   this->generateUserTypeMemberVars = &TypeGenerator::_generateUserTypeMemberVars;
   this->generateUserTypeAutoConstructor = &TypeGenerator::_generateUserTypeAutoConstructor;
@@ -145,6 +147,8 @@ Bool TypeGenerator::_generateType(TiObject *self, Spp::Ast::Type *astType, Gener
     return typeGenerator->generateReferenceType(static_cast<Spp::Ast::ReferenceType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     return typeGenerator->generateArrayType(static_cast<Spp::Ast::ArrayType*>(astType), g, session);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    return typeGenerator->generateVectorType(static_cast<Spp::Ast::VectorType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     return typeGenerator->generateUserType(static_cast<Spp::Ast::UserType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::FunctionType>()) {
@@ -245,6 +249,28 @@ Bool TypeGenerator::_generateArrayType(TiObject *self, Spp::Ast::ArrayType *astT
 }
 
 
+Bool TypeGenerator::_generateVectorType(
+  TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session
+) {
+  PREPARE_SELF(typeGenerator, TypeGenerator);
+  auto elementAstType = astType->getElementType(typeGenerator->astHelper);
+  if (
+    elementAstType == 0 ||
+    (!elementAstType->isDerivedFrom<Spp::Ast::IntegerType>() && !elementAstType->isDerivedFrom<Spp::Ast::FloatType>())
+  ) {
+    typeGenerator->noticeStore->add(newSrdObj<Spp::Notices::InvalidVectorElementTypeNotice>());
+    return false;
+  }
+  if (!typeGenerator->generateType(elementAstType, g, session)) return false;
+  TiObject *elementTgType = session->getEda()->getCodeGenData<TiObject>(elementAstType);
+  auto size = astType->getSize(typeGenerator->astHelper);
+  TioSharedPtr tgType;
+  if (!session->getTg()->generateVectorType(elementTgType, size, tgType)) return false;
+  session->getEda()->setCodeGenData(astType, tgType);
+  return true;
+}
+
+
 Bool TypeGenerator::_generateUserType(TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session)
 {
   PREPARE_SELF(typeGenerator, TypeGenerator);
@@ -642,6 +668,33 @@ Bool TypeGenerator::_generateCast(
     return typeGenerator->generateCast(
       g, session, callResult.astType, targetType, astNode, callResult.targetData.get(), implicit, result
     );
+  } else if (targetType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    // Casting to vector.
+    auto targetVectorType = static_cast<Spp::Ast::VectorType*>(targetType);
+    TiObject *targetTgType;
+    if (!typeGenerator->getGeneratedType(targetVectorType, g, session, targetTgType, 0)) return false;
+    if (srcType->isDerivedFrom<Spp::Ast::VectorType>()) {
+      // Cast from vector to another vector of the same size, element by element.
+      TiObject *srcTgType;
+      if (!typeGenerator->getGeneratedType(srcType, g, session, srcTgType, 0)) return false;
+      if (!session->getTg()->generateCastVectorToVector(
+        session->getTgContext(), srcTgType, targetTgType, tgValue, result.targetData
+      )) return false;
+      result.astType = targetType;
+      return true;
+    } else if (srcType->isDerivedFrom<Spp::Ast::IntegerType>() || srcType->isDerivedFrom<Spp::Ast::FloatType>()) {
+      // Splat a scalar into all the elements after casting it to the element type.
+      GenResult elementResult;
+      if (!typeGenerator->generateCast(
+        g, session, srcType, targetVectorType->getElementType(typeGenerator->astHelper), astNode, tgValue, implicit,
+        elementResult
+      )) return false;
+      if (!session->getTg()->generateCastScalarToVector(
+        session->getTgContext(), targetTgType, elementResult.targetData.get(), result.targetData
+      )) return false;
+      result.astType = targetType;
+      return true;
+    }
   } else if (srcType->isDerivedFrom<Spp::Ast::IntegerType>()) {
     // Casting from integer.
     auto srcIntegerType = static_cast<Spp::Ast::IntegerType*>(srcType);
@@ -809,6 +862,25 @@ Bool TypeGenerator::_generateDefaultValue(
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     // Generate zeroed out array.
     return typeGenerator->generateDefaultArrayValue(static_cast<Ast::ArrayType*>(astType), g, session, result);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    // Generate zeroed out vector.
+    auto tgType = session->getEda()->tryGetCodeGenData<TiObject>(astType);
+    if (tgType == 0) {
+      if (!typeGenerator->generateType(astType, g, session)) return false;
+      tgType = session->getEda()->getCodeGenData<TiObject>(astType);
+    }
+
+    auto vectorType = static_cast<Spp::Ast::VectorType*>(astType);
+    TioSharedPtr elementVal;
+    if (!typeGenerator->generateDefaultValue(
+      vectorType->getElementType(typeGenerator->astHelper), g, session, elementVal
+    )) return false;
+    auto size = vectorType->getSize(typeGenerator->astHelper);
+    SharedList<TiObject> elementVals;
+    for (Word i = 0; i < size; ++i) {
+      elementVals.add(elementVal);
+    }
+    return session->getTg()->generateArrayLiteral(session->getTgContext(), tgType, &elementVals, result);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     // Generate zeroed out structure.
     return typeGenerator->generateDefaultUserTypeValue(static_cast<Ast::UserType*>(astType), g, session, result);
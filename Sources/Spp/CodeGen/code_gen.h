@@ -36,6 +36,26 @@ struct GenResult
 
 s_enum(TerminalStatement, UNKNOWN, NO, YES);
 
+/// The read-modify-write operations that can be done atomically on a variable.
+s_enum(AtomicRmwOp, ADD, SUB, XCHG, AND, OR, XOR, MAX, MIN);
+
+/// The memory orderings of atomic operations and fences, from the weakest to the strongest.
+s_enum(AtomicOrdering, RELAXED, ACQUIRE, RELEASE, ACQ_REL, SEQ_CST);
+
+/// The horizontal reductions that combine the elements of a vector into a single value.
+s_enum(VectorReduceOp, ADD, MUL, MIN, MAX, AND, OR);
+
+/// Optimization hints attached to generated functions, combined as bit flags.
+s_enum(FunctionAttributes,
+  NONE = 0,
+  ALWAYS_INLINE = 1,
+  NO_INLINE = 2,
+  HOT = 4,
+  COLD = 8,
+  READ_NONE = 16,
+  READ_ONLY = 32
+);
+
 
 //==============================================================================
 // Global Functions
@@ -110,6 +130,23 @@ inline void removeExtra(OT *object, Char const *name)
   metadata->removeExtra(name);
 }
 
+// getAtomicOrdering
+
+/// Gets the memory ordering named by the given identifier, if it names one.
+inline Bool getAtomicOrdering(TiObject *astNode, Int &ordering)
+{
+  auto identifier = ti_cast<Core::Data::Ast::Identifier>(astNode);
+  if (identifier == 0) return false;
+  auto const &name = identifier->getValue();
+  if (name == S("relaxed") || name == S("مرن")) ordering = AtomicOrdering::RELAXED;
+  else if (name == S("acquire") || name == S("استحواذ")) ordering = AtomicOrdering::ACQUIRE;
+  else if (name == S("release") || name == S("تحرير")) ordering = AtomicOrdering::RELEASE;
+  else if (name == S("acq_rel") || name == S("استحواذ_تحرير")) ordering = AtomicOrdering::ACQ_REL;
+  else if (name == S("seq_cst") || name == S("تسلسلي")) ordering = AtomicOrdering::SEQ_CST;
+  else return false;
+  return true;
+}
+
 // Ast Related Accessors
 
 #define DEFINE_FLAG_ACCESSORS(name) \
@@ -123,6 +160,18 @@ inline void removeExtra(OT *object, Char const *name)
 
 DEFINE_FLAG_ACCESSORS(AstProcessed);
 
+/// Resets the processed flag of the given node and its owners so that the next processing pass visits new elements
+/// added to that node.
+inline void resetAstProcessedWithOwners(TiObject *object)
+{
+  while (object != 0) {
+    auto metaHaving = ti_cast<Core::Data::Ast::MetaHaving>(object);
+    if (metaHaving != 0) resetAstProcessed(metaHaving);
+    auto node = ti_cast<Core::Data::Node>(object);
+    object = node == 0 ? 0 : node->getOwner();
+  }
+}
+
 } // namespace
 
 
@@ -148,6 +197,7 @@ class TargetGeneration;
 #include "ExtraDataAccessor.h"
 #include "DestructionStack.h"
 #include "Session.h"
+#include "ConstantFolder.h"
 
 // Data
 #include "IfTgContext.h"
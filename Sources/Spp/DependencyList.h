@@ -16,12 +16,33 @@
 namespace Spp
 {
 
+/**
+ * @brief A list of unique dependencies kept in insertion order.
+ * @ingroup spp
+ *
+ * The build manager relies on the insertion order when generating the global
+ * constructors and destructors, while a hash set of the items allows rejecting
+ * duplicates without scanning the list.
+ */
 template<class CTYPE> class DependencyList : public PlainList<CTYPE>
 {
+  //============================================================================
+  // Member Variables
+
+  private: std::unordered_set<CTYPE*> itemSet;
+
+
   //============================================================================
   // Constructor & Destructor
 
-  public: using PlainList<CTYPE>::PlainList;
+  public: DependencyList()
+  {
+  }
+
+  public: DependencyList(std::initializer_list<CTYPE*> const &args)
+  {
+    for (auto arg : args) this->add(arg);
+  }
 
 
   //============================================================================
@@ -29,10 +50,27 @@ template<class CTYPE> class DependencyList : public PlainList<CTYPE>
 
   public: void add(CTYPE *f)
   {
-    for (Int i = 0; i < this->getCount(); ++i) if (this->get(i) == f) return;
+    if (!this->itemSet.insert(f).second) return;
     PlainList<CTYPE>::add(f);
   }
 
+  public: Bool contains(CTYPE *f) const
+  {
+    return this->itemSet.find(f) != this->itemSet.end();
+  }
+
+  public: void remove(Int index)
+  {
+    this->itemSet.erase(this->get(index));
+    PlainList<CTYPE>::remove(index);
+  }
+
+  public: void clear()
+  {
+    this->itemSet.clear();
+    PlainList<CTYPE>::clear();
+  }
+
 }; // class
 
 } // namespace
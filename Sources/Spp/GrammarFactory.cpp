@@ -60,13 +60,40 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
-    S("next_arg"), S("المعطى_التالي")
+    S("next_arg"), S("المعطى_التالي"),
+    S("atomic_load"), S("اقرأ_ذريا"),
+    S("atomic_store"), S("اكتب_ذريا"),
+    S("atomic_add"), S("اجمع_ذريا"),
+    S("atomic_sub"), S("اطرح_ذريا"),
+    S("atomic_xchg"), S("بادل_ذريا"),
+    S("atomic_cas"), S("قارن_وبادل_ذريا"),
+    S("atomic_and"), S("و_ذريا"),
+    S("atomic_or"), S("أو_ذريا"),
+    S("atomic_xor"), S("أو_حصري_ذريا"),
+    S("atomic_max"), S("أكبر_ذريا"),
+    S("atomic_min"), S("أصغر_ذريا"),
+    S("atomic_fence"), S("حاجز_ذري"),
+    S("shuffle"), S("خلط"),
+    S("reduce_add"), S("اجمع_العناصر"),
+    S("reduce_mul"), S("اضرب_العناصر"),
+    S("reduce_min"), S("أصغر_العناصر"),
+    S("reduce_max"), S("أكبر_العناصر"),
+    S("reduce_and"), S("و_العناصر"),
+    S("reduce_or"), S("أو_العناصر")
   });
 
   // Add translations for def modifiers.
   this->set(S("root.Main.Def.modifierTranslations.مشترك"), TiStr::create(S("shared")));
   this->set(S("root.Main.Def.modifierTranslations.دون_ربط"), TiStr::create(S("no_bind")));
   this->set(S("root.Main.Def.modifierTranslations.حقنة"), TiStr::create(S("injection")));
+  this->set(S("root.Main.Def.modifierTranslations.مضمن"), TiStr::create(S("inline")));
+  this->set(S("root.Main.Def.modifierTranslations.دون_تضمين"), TiStr::create(S("noinline")));
+  this->set(S("root.Main.Def.modifierTranslations.ساخن"), TiStr::create(S("hot")));
+  this->set(S("root.Main.Def.modifierTranslations.بارد"), TiStr::create(S("cold")));
+  this->set(S("root.Main.Def.modifierTranslations.نقي"), TiStr::create(S("pure")));
+  this->set(S("root.Main.Def.modifierTranslations.للقراءة_فقط"), TiStr::create(S("readonly")));
+  this->set(S("root.Main.Def.modifierTranslations.دون_تداخل"), TiStr::create(S("noalias")));
+  this->set(S("root.Main.Def.modifierTranslations.استدعاء_ذيلي"), TiStr::create(S("tailcall")));
 
   // Create leading commands.
 
@@ -175,6 +202,36 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     state->setData(continueStatement);
   }));
 
+  //// atomic_fence = "atomic_fence" + Subject.Parameter
+  this->createCommand(S("root.Main.AtomicFence"), {{
+    Map::create({}, { { S("atomic_fence"), 0 }, { S("حاجز_ذري"), 0 } }),
+    {{
+      PARSE_REF(S("module.Subject.Parameter")),
+      TiInt::create(0),
+      TiInt::create(1),
+      TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+    }}
+  }}, newSrdObj<CustomParsingHandler>([](Parser *parser, ParserState *state) {
+    auto metadata = state->getData().ti_cast_get<Data::Ast::MetaHaving>();
+    auto currentList = state->getData().ti_cast_get<Containing<TiObject>>();
+    auto fenceStatement = Ast::AtomicFenceStatement::create({
+      { S("prodId"), metadata->getProdId() },
+      { S("sourceLocation"), metadata->findSourceLocation() }
+    });
+    if (currentList != 0) {
+      auto identifier = ti_cast<Core::Data::Ast::Identifier>(currentList->getElement(1));
+      if (currentList->getElement(1) != 0 && identifier == 0) {
+        state->addNotice(
+          newSrdObj<Spp::Notices::InvalidAtomicFenceStatementNotice>(metadata->findSourceLocation())
+        );
+        state->setData(SharedPtr<TiObject>(0));
+        return;
+      }
+      fenceStatement->setOrdering(getSharedPtr(identifier));
+    }
+    state->setData(fenceStatement);
+  }));
+
   //// break = "break" + Subject.Literal
   this->createCommand(S("root.Main.Break"), {{
     Map::create({}, { { S("break"), 0 }, { S("اقطع"), 0 } }),
@@ -332,7 +389,15 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
   this->set(S("root.Main.Function.modifierTranslations"), Map::create({}, {
     {S("تصدير"), TiStr::create(S("expname"))},
     {S("مشترك"), TiStr::create(S("shared"))},
-    {S("دون_ربط"), TiStr::create(S("no_bind"))}
+    {S("دون_ربط"), TiStr::create(S("no_bind"))},
+    {S("مضمن"), TiStr::create(S("inline"))},
+    {S("دون_تضمين"), TiStr::create(S("noinline"))},
+    {S("ساخن"), TiStr::create(S("hot"))},
+    {S("بارد"), TiStr::create(S("cold"))},
+    {S("نقي"), TiStr::create(S("pure"))},
+    {S("للقراءة_فقط"), TiStr::create(S("readonly"))},
+    {S("دون_تداخل"), TiStr::create(S("noalias"))},
+    {S("استدعاء_ذيلي"), TiStr::create(S("tailcall"))}
   }));
 
   // FuncSigExpression
@@ -708,6 +773,222 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
       }
     }
   }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::NextArgOp>::create());
+  // ~atomic_load
+  this->createCommand(S("root.Main.AtomicLoadTilde"), {{
+    Map::create({}, {{S("atomic_load"), 0}, {S("اقرأ_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("load")));
+  // ~atomic_store
+  this->createCommand(S("root.Main.AtomicStoreTilde"), {{
+    Map::create({}, {{S("atomic_store"), 0}, {S("اكتب_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("store")));
+  // ~atomic_add
+  this->createCommand(S("root.Main.AtomicAddTilde"), {{
+    Map::create({}, {{S("atomic_add"), 0}, {S("اجمع_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("add")));
+  // ~atomic_sub
+  this->createCommand(S("root.Main.AtomicSubTilde"), {{
+    Map::create({}, {{S("atomic_sub"), 0}, {S("اطرح_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("sub")));
+  // ~atomic_xchg
+  this->createCommand(S("root.Main.AtomicXchgTilde"), {{
+    Map::create({}, {{S("atomic_xchg"), 0}, {S("بادل_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("xchg")));
+  // ~atomic_cas
+  this->createCommand(S("root.Main.AtomicCasTilde"), {{
+    Map::create({}, {{S("atomic_cas"), 0}, {S("قارن_وبادل_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("cas")));
+  // ~atomic_and
+  this->createCommand(S("root.Main.AtomicAndTilde"), {{
+    Map::create({}, {{S("atomic_and"), 0}, {S("و_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("and")));
+  // ~atomic_or
+  this->createCommand(S("root.Main.AtomicOrTilde"), {{
+    Map::create({}, {{S("atomic_or"), 0}, {S("أو_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("or")));
+  // ~atomic_xor
+  this->createCommand(S("root.Main.AtomicXorTilde"), {{
+    Map::create({}, {{S("atomic_xor"), 0}, {S("أو_حصري_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("xor")));
+  // ~atomic_max
+  this->createCommand(S("root.Main.AtomicMaxTilde"), {{
+    Map::create({}, {{S("atomic_max"), 0}, {S("أكبر_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("max")));
+  // ~atomic_min
+  this->createCommand(S("root.Main.AtomicMinTilde"), {{
+    Map::create({}, {{S("atomic_min"), 0}, {S("أصغر_ذريا"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::AtomicOpParsingHandler::create(S("min")));
+  // ~shuffle
+  this->createCommand(S("root.Main.ShuffleTilde"), {{
+    Map::create({}, {{S("shuffle"), 0}, {S("خلط"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("shuffle")));
+  // ~reduce_add
+  this->createCommand(S("root.Main.ReduceAddTilde"), {{
+    Map::create({}, {{S("reduce_add"), 0}, {S("اجمع_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_add")));
+  // ~reduce_mul
+  this->createCommand(S("root.Main.ReduceMulTilde"), {{
+    Map::create({}, {{S("reduce_mul"), 0}, {S("اضرب_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_mul")));
+  // ~reduce_min
+  this->createCommand(S("root.Main.ReduceMinTilde"), {{
+    Map::create({}, {{S("reduce_min"), 0}, {S("أصغر_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_min")));
+  // ~reduce_max
+  this->createCommand(S("root.Main.ReduceMaxTilde"), {{
+    Map::create({}, {{S("reduce_max"), 0}, {S("أكبر_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_max")));
+  // ~reduce_and
+  this->createCommand(S("root.Main.ReduceAndTilde"), {{
+    Map::create({}, {{S("reduce_and"), 0}, {S("و_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_and")));
+  // ~reduce_or
+  this->createCommand(S("root.Main.ReduceOrTilde"), {{
+    Map::create({}, {{S("reduce_or"), 0}, {S("أو_العناصر"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(0),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::VectorOpParsingHandler::create(S("reduce_or")));
 
   // Add command references.
 
@@ -718,6 +999,7 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     PARSE_REF(S("module.Continue")),
     PARSE_REF(S("module.Break")),
     PARSE_REF(S("module.Return")),
+    PARSE_REF(S("module.AtomicFence")),
     PARSE_REF(S("module.TypeOp"))
   });
 
@@ -732,7 +1014,25 @@ void GrammarFactory::createGrammar(Core::Main::RootManager *root) {
     PARSE_REF(S("module.PointerTilde")),
     PARSE_REF(S("module.InitTilde")),
     PARSE_REF(S("module.TerminateTilde")),
-    PARSE_REF(S("module.NextArgTilde"))
+    PARSE_REF(S("module.NextArgTilde")),
+    PARSE_REF(S("module.AtomicLoadTilde")),
+    PARSE_REF(S("module.AtomicStoreTilde")),
+    PARSE_REF(S("module.AtomicAddTilde")),
+    PARSE_REF(S("module.AtomicSubTilde")),
+    PARSE_REF(S("module.AtomicXchgTilde")),
+    PARSE_REF(S("module.AtomicCasTilde")),
+    PARSE_REF(S("module.AtomicAndTilde")),
+    PARSE_REF(S("module.AtomicOrTilde")),
+    PARSE_REF(S("module.AtomicXorTilde")),
+    PARSE_REF(S("module.AtomicMaxTilde")),
+    PARSE_REF(S("module.AtomicMinTilde")),
+    PARSE_REF(S("module.ShuffleTilde")),
+    PARSE_REF(S("module.ReduceAddTilde")),
+    PARSE_REF(S("module.ReduceMulTilde")),
+    PARSE_REF(S("module.ReduceMinTilde")),
+    PARSE_REF(S("module.ReduceMaxTilde")),
+    PARSE_REF(S("module.ReduceAndTilde")),
+    PARSE_REF(S("module.ReduceOrTilde"))
   });
 
   this->addProdsToGroup(S("root.Main.SubjectCmdGrp"), {
@@ -786,13 +1086,40 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
-    S("next_arg"), S("المعطى_التالي")
+    S("next_arg"), S("المعطى_التالي"),
+    S("atomic_load"), S("اقرأ_ذريا"),
+    S("atomic_store"), S("اكتب_ذريا"),
+    S("atomic_add"), S("اجمع_ذريا"),
+    S("atomic_sub"), S("اطرح_ذريا"),
+    S("atomic_xchg"), S("بادل_ذريا"),
+    S("atomic_cas"), S("قارن_وبادل_ذريا"),
+    S("atomic_and"), S("و_ذريا"),
+    S("atomic_or"), S("أو_ذريا"),
+    S("atomic_xor"), S("أو_حصري_ذريا"),
+    S("atomic_max"), S("أكبر_ذريا"),
+    S("atomic_min"), S("أصغر_ذريا"),
+    S("atomic_fence"), S("حاجز_ذري"),
+    S("shuffle"), S("خلط"),
+    S("reduce_add"), S("اجمع_العناصر"),
+    S("reduce_mul"), S("اضرب_العناصر"),
+    S("reduce_min"), S("أصغر_العناصر"),
+    S("reduce_max"), S("أكبر_العناصر"),
+    S("reduce_and"), S("و_العناصر"),
+    S("reduce_or"), S("أو_العناصر")
   });
 
   // Add translation for static modifier.
   this->remove(S("root.Main.Def.modifierTranslations.مشترك"));
   this->remove(S("root.Main.Def.modifierTranslations.دون_ربط"));
   this->remove(S("root.Main.Def.modifierTranslations.حقنة"));
+  this->remove(S("root.Main.Def.modifierTranslations.مضمن"));
+  this->remove(S("root.Main.Def.modifierTranslations.دون_تضمين"));
+  this->remove(S("root.Main.Def.modifierTranslations.ساخن"));
+  this->remove(S("root.Main.Def.modifierTranslations.بارد"));
+  this->remove(S("root.Main.Def.modifierTranslations.نقي"));
+  this->remove(S("root.Main.Def.modifierTranslations.للقراءة_فقط"));
+  this->remove(S("root.Main.Def.modifierTranslations.دون_تداخل"));
+  this->remove(S("root.Main.Def.modifierTranslations.استدعاء_ذيلي"));
 
   // Remove commands from tilde commands list.
   this->removeProdsFromGroup(S("root.Main.PostfixTildeCmdGrp"), {
@@ -806,7 +1133,25 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("module.PointerTilde"),
     S("module.InitTilde"),
     S("module.TerminateTilde"),
-    S("module.NextArgTilde")
+    S("module.NextArgTilde"),
+    S("module.AtomicLoadTilde"),
+    S("module.AtomicStoreTilde"),
+    S("module.AtomicAddTilde"),
+    S("module.AtomicSubTilde"),
+    S("module.AtomicXchgTilde"),
+    S("module.AtomicCasTilde"),
+    S("module.AtomicAndTilde"),
+    S("module.AtomicOrTilde"),
+    S("module.AtomicXorTilde"),
+    S("module.AtomicMaxTilde"),
+    S("module.AtomicMinTilde"),
+    S("module.ShuffleTilde"),
+    S("module.ReduceAddTilde"),
+    S("module.ReduceMulTilde"),
+    S("module.ReduceMinTilde"),
+    S("module.ReduceMaxTilde"),
+    S("module.ReduceAndTilde"),
+    S("module.ReduceOrTilde")
   });
 
   // Remove commands from leading commands list.
@@ -817,6 +1162,7 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
     S("module.Continue"),
     S("module.Break"),
     S("module.Return"),
+    S("module.AtomicFence"),
     S("module.TypeOp")
   });
 
@@ -847,6 +1193,24 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
   this->tryRemove(S("root.Main.TerminateTilde"));
   this->tryRemove(S("root.Main.TerminateTildeSubject"));
   this->tryRemove(S("root.Main.NextArgTilde"));
+  this->tryRemove(S("root.Main.AtomicLoadTilde"));
+  this->tryRemove(S("root.Main.AtomicStoreTilde"));
+  this->tryRemove(S("root.Main.AtomicAddTilde"));
+  this->tryRemove(S("root.Main.AtomicSubTilde"));
+  this->tryRemove(S("root.Main.AtomicXchgTilde"));
+  this->tryRemove(S("root.Main.AtomicCasTilde"));
+  this->tryRemove(S("root.Main.AtomicAndTilde"));
+  this->tryRemove(S("root.Main.AtomicOrTilde"));
+  this->tryRemove(S("root.Main.AtomicXorTilde"));
+  this->tryRemove(S("root.Main.AtomicMaxTilde"));
+  this->tryRemove(S("root.Main.AtomicMinTilde"));
+  this->tryRemove(S("root.Main.ShuffleTilde"));
+  this->tryRemove(S("root.Main.ReduceAddTilde"));
+  this->tryRemove(S("root.Main.ReduceMulTilde"));
+  this->tryRemove(S("root.Main.ReduceMinTilde"));
+  this->tryRemove(S("root.Main.ReduceMaxTilde"));
+  this->tryRemove(S("root.Main.ReduceAndTilde"));
+  this->tryRemove(S("root.Main.ReduceOrTilde"));
 
   // Delete leading command definitions.
   this->tryRemove(S("root.Main.If"));
@@ -855,6 +1219,7 @@ void GrammarFactory::cleanGrammar(Core::Main::RootManager *root)
   this->tryRemove(S("root.Main.Continue"));
   this->tryRemove(S("root.Main.Break"));
   this->tryRemove(S("root.Main.Return"));
+  this->tryRemove(S("root.Main.AtomicFence"));
   this->tryRemove(S("root.Main.TypeOp"));
 
   // Delete inner command definitions.
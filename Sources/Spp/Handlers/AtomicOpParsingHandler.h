@@ -0,0 +1,70 @@
+/**
+ * @file Spp/Handlers/AtomicOpParsingHandler.h
+ * Contains the header of class Spp::Handlers::AtomicOpParsingHandler
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_HANDLERS_ATOMICOPPARSINGHANDLER_H
+#define SPP_HANDLERS_ATOMICOPPARSINGHANDLER_H
+
+namespace Spp { namespace Handlers
+{
+
+/**
+ * @brief Parsing handler for the ~atomic_* operators.
+ * @ingroup spp_handlers
+ *
+ * Each of these operators has its own command in the grammar, and each
+ * command gets an instance of this handler that records the operation in
+ * the generated AtomicOp node.
+ */
+class AtomicOpParsingHandler : public TildeOpParsingHandler<Spp::Ast::AtomicOp>
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(
+    AtomicOpParsingHandler, TildeOpParsingHandler<Spp::Ast::AtomicOp>, "Spp.Handlers", "Spp", "alusus.org"
+  );
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Str operation;
+
+
+  //============================================================================
+  // Constructor
+
+  public: AtomicOpParsingHandler(Char const *op) : operation(op)
+  {
+  }
+
+  public: static SharedPtr<AtomicOpParsingHandler> create(Char const *op)
+  {
+    return newSrdObj<AtomicOpParsingHandler>(op);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: virtual void onProdStart(
+    Core::Processing::Parser *parser, Core::Processing::ParserState *state, Core::Data::Token const *token
+  ) {
+    TildeOpParsingHandler<Spp::Ast::AtomicOp>::onProdStart(parser, state, token);
+    state->getData().s_cast_get<Spp::Ast::AtomicOp>()->setOperation(this->operation.getBuf());
+  }
+
+}; // class
+
+} } // namespace
+
+#endif
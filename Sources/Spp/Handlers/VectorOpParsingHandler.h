@@ -0,0 +1,70 @@
+/**
+ * @file Spp/Handlers/VectorOpParsingHandler.h
+ * Contains the header of class Spp::Handlers::VectorOpParsingHandler
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_HANDLERS_VECTOROPPARSINGHANDLER_H
+#define SPP_HANDLERS_VECTOROPPARSINGHANDLER_H
+
+namespace Spp { namespace Handlers
+{
+
+/**
+ * @brief Parsing handler for the ~shuffle and ~reduce_* operators.
+ * @ingroup spp_handlers
+ *
+ * Each of these operators has its own command in the grammar, and each
+ * command gets an instance of this handler that records the operation in
+ * the generated VectorOp node.
+ */
+class VectorOpParsingHandler : public TildeOpParsingHandler<Spp::Ast::VectorOp>
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(
+    VectorOpParsingHandler, TildeOpParsingHandler<Spp::Ast::VectorOp>, "Spp.Handlers", "Spp", "alusus.org"
+  );
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Str operation;
+
+
+  //============================================================================
+  // Constructor
+
+  public: VectorOpParsingHandler(Char const *op) : operation(op)
+  {
+  }
+
+  public: static SharedPtr<VectorOpParsingHandler> create(Char const *op)
+  {
+    return newSrdObj<VectorOpParsingHandler>(op);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: virtual void onProdStart(
+    Core::Processing::Parser *parser, Core::Processing::ParserState *state, Core::Data::Token const *token
+  ) {
+    TildeOpParsingHandler<Spp::Ast::VectorOp>::onProdStart(parser, state, token);
+    state->getData().s_cast_get<Spp::Ast::VectorOp>()->setOperation(this->operation.getBuf());
+  }
+
+}; // class
+
+} } // namespace
+
+#endif
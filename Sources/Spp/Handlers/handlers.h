@@ -42,6 +42,8 @@ Bool parseNumber(
 #include "WhileParsingHandler.h"
 #include "ForParsingHandler.h"
 #include "TildeOpParsingHandler.h"
+#include "AtomicOpParsingHandler.h"
+#include "VectorOpParsingHandler.h"
 #include "MacroParsingHandler.h"
 #include "ModuleParsingHandler.h"
 #include "TypeParsingHandler.h"
@@ -230,6 +230,16 @@ void LibraryGateway::createBuiltInTypes(Core::Main::RootManager *manager)
   tmplt->setBody(Ast::ArrayType::create());
   identifier.setValue(S("array"));
   manager->getSeeker()->doSet(&identifier, root, tmplt.get());
+
+  // Vector
+  tmplt = Ast::Template::create();
+  tmplt->setVarDefs(Core::Data::Ast::List::create({}, {
+    newSrdObj<Ast::TemplateVarDef>(S("type"), Ast::TemplateVarType::TYPE),
+    newSrdObj<Ast::TemplateVarDef>(S("size"), Ast::TemplateVarType::INTEGER)
+  }));
+  tmplt->setBody(Ast::VectorType::create());
+  identifier.setValue(S("Vector"));
+  manager->getSeeker()->doSet(&identifier, root, tmplt.get());
 }
 
 
@@ -267,6 +277,9 @@ void LibraryGateway::removeBuiltInTypes(Core::Main::RootManager *manager)
 
   identifier.setValue(S("array"));
   manager->getSeeker()->tryRemove(&identifier, root);
+
+  identifier.setValue(S("Vector"));
+  manager->getSeeker()->tryRemove(&identifier, root);
 }
 
 
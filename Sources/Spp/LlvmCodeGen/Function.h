@@ -34,6 +34,8 @@ class Function : public TiObject
   private: llvm::Function *llvmFunction;
   private: llvm::AllocaInst *llvmVaList = 0;
   private: std::unique_ptr<llvm::Module> llvmModule;
+  private: Int attributes = 0;
+  private: std::vector<Int> noAliasArgs;
 
 
   //============================================================================
@@ -21,7 +21,9 @@ void JitBuildTarget::setupBuild()
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder().create(this->globalItemRepo));
+  JitEngineBuilder builder;
+  JitSymbolListener::addListeners(builder, this->publishingSymbols);
+  this->llvmJitEngine = llvm::cantFail(builder.create(this->globalItemRepo));
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -71,9 +73,15 @@ void JitBuildTarget::execute(Char const *entry)
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
-  auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
-  auto funcPtr = (FuncType)llvmEntry.getAddress();
+  FuncType funcPtr;
+  {
+    // Looking up the entry is what triggers compiling and linking the pending modules.
+    Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::LINKING);
+    auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
+    funcPtr = (FuncType)llvmEntry.getAddress();
+  }
 
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::EXECUTION);
   funcPtr();
 }
 
@@ -0,0 +1,88 @@
+/**
+ * @file Spp/LlvmCodeGen/JitSymbolListener.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitSymbolListener.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+#include <unistd.h>
+
+namespace Spp::LlvmCodeGen
+{
+
+void JitSymbolListener::notifyObjectLoaded(
+  ObjectKey key, llvm::object::ObjectFile const &obj, llvm::RuntimeDyld::LoadedObjectInfo const &info
+) {
+  auto profiler = Core::Main::Profiler::getSingleton();
+  if (!this->writingPerfMap && !profiler->isEnabled()) return;
+
+  // The debug object has its sections relocated to their load addresses.
+  auto debugObj = info.getObjectForDebug(obj);
+  if (debugObj.getBinary() == 0) return;
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (this->writingPerfMap && this->perfMap == 0) {
+    Char filename[64];
+    snprintf(filename, sizeof(filename), "/tmp/perf-%d.map", (int)getpid());
+    this->perfMap = fopen(filename, "w");
+    if (this->perfMap == 0) this->writingPerfMap = false;
+  }
+
+  for (auto const &symbolSize : llvm::object::computeSymbolSizes(*debugObj.getBinary())) {
+    auto symbol = symbolSize.first;
+    auto type = symbol.getType();
+    if (!type) {
+      llvm::consumeError(type.takeError());
+      continue;
+    }
+    if (*type != llvm::object::SymbolRef::ST_Function) continue;
+    auto name = symbol.getName();
+    if (!name) {
+      llvm::consumeError(name.takeError());
+      continue;
+    }
+    auto address = symbol.getAddress();
+    if (!address) {
+      llvm::consumeError(address.takeError());
+      continue;
+    }
+    if (symbolSize.second == 0) continue;
+
+    std::string nameStr = name->str();
+    if (this->writingPerfMap) {
+      fprintf(this->perfMap, "%lx %lx %s\n", (unsigned long)*address, (unsigned long)symbolSize.second, nameStr.c_str());
+    }
+    if (profiler->isEnabled()) {
+      profiler->addSymbol(*address, symbolSize.second, nameStr.c_str());
+    }
+  }
+  if (this->writingPerfMap) fflush(this->perfMap);
+}
+
+
+void JitSymbolListener::addListeners(JitEngineBuilderState &builder, Bool publishingSymbols)
+{
+  auto listener = JitSymbolListener::getSingleton();
+  if (publishingSymbols) {
+    listener->setWritingPerfMap(true);
+    builder.eventListeners.push_back(llvm::JITEventListener::createGDBRegistrationListener());
+  }
+  if (publishingSymbols || Core::Main::Profiler::getSingleton()->isEnabled()) {
+    builder.eventListeners.push_back(listener);
+  }
+}
+
+
+JitSymbolListener* JitSymbolListener::getSingleton()
+{
+  static JitSymbolListener listener;
+  return &listener;
+}
+
+} // namespace
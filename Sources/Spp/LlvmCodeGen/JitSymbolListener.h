@@ -0,0 +1,79 @@
+/**
+ * @file Spp/LlvmCodeGen/JitSymbolListener.h
+ * Contains the header of class Spp::LlvmCodeGen::JitSymbolListener.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITSYMBOLLISTENER_H
+#define SPP_LLVMCODEGEN_JITSYMBOLLISTENER_H
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief Publishes the functions of JIT compiled objects.
+ * @ingroup spp_llvmcodegen
+ *
+ * Gets notified by the object linking layer whenever an object is loaded and
+ * publishes the addresses and sizes of its functions to perf through
+ * /tmp/perf-<pid>.map and to Core's sampling profiler. Objects are also
+ * registered with GDB's JIT interface through LLVM's own listener when
+ * symbols are published.
+ */
+class JitSymbolListener : public llvm::JITEventListener
+{
+  //============================================================================
+  // Member Variables
+
+  private: Bool writingPerfMap = false;
+  private: FILE *perfMap = 0;
+  private: std::mutex mutex;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: JitSymbolListener()
+  {
+  }
+
+  public: virtual ~JitSymbolListener()
+  {
+    if (this->perfMap != 0) fclose(this->perfMap);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setWritingPerfMap(Bool w)
+  {
+    this->writingPerfMap = w;
+  }
+
+  public: Bool isWritingPerfMap() const
+  {
+    return this->writingPerfMap;
+  }
+
+  public: virtual void notifyObjectLoaded(
+    ObjectKey key, llvm::object::ObjectFile const &obj, llvm::RuntimeDyld::LoadedObjectInfo const &info
+  ) override;
+
+  /// Adds the listeners needed by the published symbols and the profiler to the given JIT engine builder.
+  public: static void addListeners(JitEngineBuilderState &builder, Bool publishingSymbols);
+
+  /// Get the listener shared by all JIT engines.
+  public: static JitSymbolListener* getSingleton();
+
+}; // class
+
+} // namespace
+
+#endif
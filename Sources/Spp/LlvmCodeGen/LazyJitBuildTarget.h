@@ -34,6 +34,7 @@ class LazyJitBuildTarget : public BuildTarget
   private: std::unique_ptr<llvm::Module> llvmModule;
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
+  private: Bool publishingSymbols = false;
 
 
   //============================================================================
@@ -56,6 +57,17 @@ class LazyJitBuildTarget : public BuildTarget
 
   public: virtual void setupBuild();
 
+  /// Publish the symbols of compiled code to perf and GDB. Takes effect on the next setupBuild.
+  public: void setPublishingSymbols(Bool p)
+  {
+    this->publishingSymbols = p;
+  }
+
+  public: Bool isPublishingSymbols() const
+  {
+    return this->publishingSymbols;
+  }
+
   public: virtual llvm::DataLayout* getLlvmDataLayout()
   {
     return this->llvmDataLayout;
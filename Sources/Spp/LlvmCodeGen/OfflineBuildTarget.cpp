@@ -11,10 +11,59 @@
 //==============================================================================
 
 #include "spp.h"
+#include <thread>
 
 namespace Spp::LlvmCodeGen
 {
 
+void OfflineBuildTarget::setBuildOptions(BuildOptions const *options)
+{
+  if (options == 0) {
+    this->cpu.clear();
+    this->features.clear();
+    this->optLevel = 0;
+    this->sizeLevel = 0;
+    this->emitBitcode = false;
+    this->partitionCount = 1;
+    this->profileGenerate.clear();
+    this->profileUse.clear();
+    this->codeGenOptLevel = llvm::CodeGenOpt::Default;
+    return;
+  }
+
+  if (options->optLevel < 0 || options->optLevel > 3) {
+    throw EXCEPTION(
+      InvalidArgumentException, S("options"), S("Optimization level must be between 0 and 3."), options->optLevel
+    );
+  }
+  if (options->sizeLevel < 0 || options->sizeLevel > 2) {
+    throw EXCEPTION(
+      InvalidArgumentException, S("options"), S("Size optimization level must be between 0 and 2."), options->sizeLevel
+    );
+  }
+
+  this->cpu = options->cpu == 0 ? "" : options->cpu;
+  this->features = options->features == 0 ? "" : options->features;
+  this->optLevel = options->optLevel;
+  this->sizeLevel = options->sizeLevel;
+  this->emitBitcode = options->emitBitcode;
+  this->partitionCount = options->partitionCount < 1 ? 1 : options->partitionCount;
+  this->profileGenerate = options->profileGenerate == 0 ? "" : options->profileGenerate;
+  this->profileUse = options->profileUse == 0 ? "" : options->profileUse;
+  if (!this->profileUse.empty() && !llvm::sys::fs::exists(this->profileUse)) {
+    throw EXCEPTION(
+      InvalidArgumentException, S("options"), S("Profile file does not exist."), options->profileUse
+    );
+  }
+  switch (this->optLevel) {
+    case 0: this->codeGenOptLevel = llvm::CodeGenOpt::None; break;
+    case 1: this->codeGenOptLevel = llvm::CodeGenOpt::Less; break;
+    case 2: this->codeGenOptLevel = llvm::CodeGenOpt::Default; break;
+    default: this->codeGenOptLevel = llvm::CodeGenOpt::Aggressive; break;
+  }
+}
+
+
 void OfflineBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
@@ -23,21 +72,16 @@ void OfflineBuildTarget::setupBuild()
   this->llvmModule.reset();
 
   std::string error;
-  auto target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
+  this->target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
 
   // Print an error and exit if we couldn't find the requested target.
   // This generally occurs if we've forgotten to initialise the
   // TargetRegistry or we have a bogus target triple.
-  if (!target) {
+  if (!this->target) {
     throw EXCEPTION(GenericException, error.c_str());
   }
 
-  auto cpu = "generic";
-  auto features = "";
-
-  llvm::TargetOptions opt;
-  auto rm = llvm::Optional<llvm::Reloc::Model>();
-  this->targetMachine = target->createTargetMachine(targetTriple, cpu, features, opt, rm);
+  this->targetMachine.reset(this->createTargetMachine());
 
   this->llvmDataLayout = std::make_unique<llvm::DataLayout>(this->targetMachine->createDataLayout());
 
@@ -50,6 +94,33 @@ void OfflineBuildTarget::setupBuild()
 }
 
 
+llvm::TargetMachine* OfflineBuildTarget::createTargetMachine()
+{
+  std::string cpu = this->cpu;
+  std::string features = this->features;
+  if (cpu.empty()) {
+    cpu = "generic";
+  } else if (cpu == "native") {
+    // Tune for the CPU we are running on, similar to -march=native.
+    cpu = llvm::sys::getHostCPUName().str();
+    if (features.empty()) {
+      llvm::SubtargetFeatures subtargetFeatures;
+      llvm::StringMap<bool> hostFeatures;
+      if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+        for (auto &feature : hostFeatures) subtargetFeatures.AddFeature(feature.first(), feature.second);
+      }
+      features = subtargetFeatures.getString();
+    }
+  }
+
+  llvm::TargetOptions opt;
+  auto rm = llvm::Optional<llvm::Reloc::Model>();
+  return this->target->createTargetMachine(
+    this->targetTriple, cpu, features, opt, rm, llvm::None, this->codeGenOptLevel
+  );
+}
+
+
 llvm::Module* OfflineBuildTarget::getGlobalLlvmModule()
 {
   if (this->llvmModule == 0) {
@@ -108,6 +179,94 @@ void OfflineBuildTarget::generateObjectFile(
 
   this->llvmModule->setTargetTriple(this->targetTriple);
 
+  // Bitcode is consumed by an LTO linker that merges everything back anyway, so there is no point in
+  // splitting it.
+  if (this->partitionCount > 1 && !this->emitBitcode) {
+    this->generatePartitionedObjectFiles(filename);
+    return;
+  }
+
+  if (this->isOptimizing()) {
+    this->optimizeModule(this->llvmModule.get(), this->targetMachine.get());
+  }
+  this->emitModule(this->llvmModule.get(), this->targetMachine.get(), filename);
+}
+
+
+Str OfflineBuildTarget::getPartitionFilename(Char const *filename, Int index)
+{
+  // output.o -> output.<index>.o
+  std::string name = filename;
+  std::string extension;
+  auto dotPos = name.rfind(C('.'));
+  auto slashPos = name.rfind(C('/'));
+  if (dotPos != std::string::npos && (slashPos == std::string::npos || dotPos > slashPos)) {
+    extension = name.substr(dotPos);
+    name.resize(dotPos);
+  }
+  return Str((name + S(".") + std::to_string(index) + extension).c_str());
+}
+
+
+void OfflineBuildTarget::generatePartitionedObjectFiles(Char const *filename)
+{
+  // LLVM contexts can't be used by multiple threads at the same time, so each partition is serialized
+  // into bitcode and then loaded by its thread into a context of its own.
+  std::vector<llvm::SmallString<0>> partitionBitcodes;
+  llvm::SplitModule(
+    std::move(this->llvmModule), this->partitionCount,
+    [&](std::unique_ptr<llvm::Module> partition) {
+      partitionBitcodes.emplace_back();
+      llvm::raw_svector_ostream stream(partitionBitcodes.back());
+      llvm::WriteBitcodeToFile(*partition, stream);
+    }
+  );
+  this->llvmModule.reset();
+
+  // Target machines are created upfront as creating them isn't guaranteed to be thread safe.
+  std::vector<std::unique_ptr<llvm::TargetMachine>> targetMachines;
+  for (Int i = 0; i < partitionBitcodes.size(); ++i) {
+    targetMachines.emplace_back(this->createTargetMachine());
+  }
+
+  // The partitions are optimized and emitted in parallel, so the time spent waiting for the threads is charged to
+  // the emission phase as a whole.
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::EMISSION);
+  std::vector<std::exception_ptr> exceptions(partitionBitcodes.size());
+  std::vector<std::thread> threads;
+  for (Int i = 0; i < partitionBitcodes.size(); ++i) {
+    threads.emplace_back([this, i, filename, &partitionBitcodes, &targetMachines, &exceptions]() {
+      try {
+        llvm::LLVMContext context;
+        auto module = llvm::parseBitcodeFile(
+          llvm::MemoryBufferRef(llvm::StringRef(partitionBitcodes[i].data(), partitionBitcodes[i].size()), ""),
+          context
+        );
+        if (!module) {
+          throw EXCEPTION(GenericException, llvm::toString(module.takeError()).c_str());
+        }
+        if (this->isOptimizing()) {
+          this->optimizeModule(module->get(), targetMachines[i].get());
+        }
+        this->emitModule(
+          module->get(), targetMachines[i].get(), OfflineBuildTarget::getPartitionFilename(filename, i).getBuf()
+        );
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  for (auto &exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
+
+void OfflineBuildTarget::emitModule(llvm::Module *module, llvm::TargetMachine *tm, Char const *filename)
+{
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::EMISSION);
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::F_None);
 
@@ -115,18 +274,69 @@ void OfflineBuildTarget::generateObjectFile(
     throw EXCEPTION(FileException, ec.message().c_str(), C('w'));
   }
 
+  if (this->emitBitcode) {
+    // Leave code generation to the LTO linker.
+    llvm::WriteBitcodeToFile(*module, dest);
+    dest.flush();
+    return;
+  }
+
   llvm::legacy::PassManager pass;
   auto fileType = llvm::CGFT_ObjectFile;
 
-  if (this->targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
+  if (tm->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
     throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
   }
 
-  pass.run(*this->llvmModule);
+  pass.run(*module);
   dest.flush();
 }
 
 
+void OfflineBuildTarget::optimizeModule(llvm::Module *module, llvm::TargetMachine *tm)
+{
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::OPTIMIZATION);
+  llvm::PassManagerBuilder builder;
+  builder.OptLevel = this->optLevel;
+  builder.SizeLevel = this->sizeLevel;
+  if (this->optLevel > 1) {
+    builder.Inliner = llvm::createFunctionInliningPass(this->optLevel, this->sizeLevel, false);
+  } else {
+    builder.Inliner = llvm::createAlwaysInlinerLegacyPass();
+  }
+  builder.LoopVectorize = this->optLevel > 1 && this->sizeLevel < 2;
+  builder.SLPVectorize = this->optLevel > 1 && this->sizeLevel < 2;
+  builder.PrepareForLTO = this->emitBitcode;
+  // Instrumentation is added even at -O0 to allow profiling unoptimized builds. Profiles are only used when
+  // optimizing, where the branch weights and function entry counts they attach drive inlining, block placement, and
+  // the placement of hot and cold functions into separate sections.
+  if (!this->profileGenerate.empty()) {
+    builder.EnablePGOInstrGen = true;
+    builder.PGOInstrGen = this->profileGenerate;
+  } else if (!this->profileUse.empty()) {
+    builder.PGOInstrUse = this->profileUse;
+  }
+  tm->adjustPassManager(builder);
+
+  llvm::legacy::FunctionPassManager fnPasses(module);
+  fnPasses.add(llvm::createTargetTransformInfoWrapperPass(tm->getTargetIRAnalysis()));
+  builder.populateFunctionPassManager(fnPasses);
+
+  fnPasses.doInitialization();
+  for (llvm::Function &func : *module) {
+    fnPasses.run(func);
+  }
+  fnPasses.doFinalization();
+
+  llvm::legacy::PassManager passes;
+  passes.add(new llvm::TargetLibraryInfoWrapperPass(tm->getTargetTriple()));
+  passes.add(llvm::createTargetTransformInfoWrapperPass(tm->getTargetIRAnalysis()));
+  builder.populateModulePassManager(passes);
+  passes.add(llvm::createVerifierPass());
+  passes.run(*module);
+}
+
+
 void OfflineBuildTarget::buildCtorOrDtorArray(std::vector<Str> const *funcNames, Char const *globalVarName)
 {
   if (this->llvmModule == 0) {
@@ -140,7 +350,8 @@ void OfflineBuildTarget::buildCtorOrDtorArray(std::vector<Str> const *funcNames,
     auto llvmFuncType = llvm::FunctionType::get(llvmVoidType, llvmArgTypes, false);
     this->llvmGlobalCtorDtorEntryTypes.llvmFuncPtrType = llvmFuncType->getPointerTo();
     auto llvmIntType = llvm::Type::getIntNTy(*this->llvmContext, 32);
-    this->llvmGlobalCtorDtorEntryTypes.llvmIntPtrType = llvmIntType->getPointerTo();
+    // The associated data pointer must be i8* or LLVM's verifier will reject the module.
+    this->llvmGlobalCtorDtorEntryTypes.llvmIntPtrType = llvm::Type::getInt8PtrTy(*this->llvmContext);
     this->llvmGlobalCtorDtorEntryTypes.llvmStructType = llvm::StructType::create(
       *this->llvmContext, "LlvmGlobalCtorDtor"
     );
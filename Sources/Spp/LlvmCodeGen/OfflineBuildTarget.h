@@ -39,7 +39,17 @@ class OfflineBuildTarget : public BuildTarget
   // Member Variables
 
   private: std::string targetTriple;
-  private: llvm::TargetMachine *targetMachine;
+  private: std::string cpu;
+  private: std::string features;
+  private: Int optLevel = 0;
+  private: Int sizeLevel = 0;
+  private: Bool emitBitcode = false;
+  private: Int partitionCount = 1;
+  private: std::string profileGenerate;
+  private: std::string profileUse;
+  private: llvm::CodeGenOpt::Level codeGenOptLevel = llvm::CodeGenOpt::Default;
+  private: llvm::Target const *target = 0;
+  private: std::unique_ptr<llvm::TargetMachine> targetMachine;
   private: std::unique_ptr<llvm::DataLayout> llvmDataLayout;
   private: std::unique_ptr<llvm::LLVMContext> llvmContext;
   private: std::unique_ptr<llvm::Module> llvmModule;
@@ -75,6 +85,53 @@ class OfflineBuildTarget : public BuildTarget
     return this->targetTriple;
   }
 
+  public: void setBuildOptions(BuildOptions const *options);
+
+  public: Int getOptLevel() const
+  {
+    return this->optLevel;
+  }
+
+  public: Int getSizeLevel() const
+  {
+    return this->sizeLevel;
+  }
+
+  public: std::string const& getCpu() const
+  {
+    return this->cpu;
+  }
+
+  public: std::string const& getFeatures() const
+  {
+    return this->features;
+  }
+
+  public: Bool isEmittingBitcode() const
+  {
+    return this->emitBitcode;
+  }
+
+  public: Int getPartitionCount() const
+  {
+    return this->partitionCount;
+  }
+
+  public: std::string const& getProfileGenerate() const
+  {
+    return this->profileGenerate;
+  }
+
+  public: std::string const& getProfileUse() const
+  {
+    return this->profileUse;
+  }
+
+  public: Bool isOptimizing() const
+  {
+    return this->optLevel > 0 || this->sizeLevel > 0 || !this->profileGenerate.empty();
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -102,6 +159,16 @@ class OfflineBuildTarget : public BuildTarget
     Char const *filename, std::vector<Str> const *ctorNames, std::vector<Str> const *dtorNames
   );
 
+  public: static Str getPartitionFilename(Char const *filename, Int index);
+
+  private: llvm::TargetMachine* createTargetMachine();
+
+  private: void generatePartitionedObjectFiles(Char const *filename);
+
+  private: void emitModule(llvm::Module *module, llvm::TargetMachine *tm, Char const *filename);
+
+  private: void optimizeModule(llvm::Module *module, llvm::TargetMachine *tm);
+
   private: void buildCtorOrDtorArray(std::vector<Str> const *funcNames, Char const *globalVarName);
 
 }; // class
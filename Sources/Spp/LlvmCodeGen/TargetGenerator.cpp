@@ -28,6 +28,7 @@ void TargetGenerator::initBindings()
   targetGeneration->generateFloatType = &TargetGenerator::generateFloatType;
   targetGeneration->generatePointerType = &TargetGenerator::generatePointerType;
   targetGeneration->generateArrayType = &TargetGenerator::generateArrayType;
+  targetGeneration->generateVectorType = &TargetGenerator::generateVectorType;
   targetGeneration->generateStructTypeDecl = &TargetGenerator::generateStructTypeDecl;
   targetGeneration->generateStructTypeBody = &TargetGenerator::generateStructTypeBody;
   targetGeneration->getTypeAllocationSize = &TargetGenerator::getTypeAllocationSize;
@@ -35,7 +36,10 @@ void TargetGenerator::initBindings()
   // Function Generation Functions
   targetGeneration->generateFunctionType = &TargetGenerator::generateFunctionType;
   targetGeneration->generateFunctionDecl = &TargetGenerator::generateFunctionDecl;
+  targetGeneration->setFunctionAttributes = &TargetGenerator::setFunctionAttributes;
+  targetGeneration->setFunctionArgNoAlias = &TargetGenerator::setFunctionArgNoAlias;
   targetGeneration->prepareFunctionBody = &TargetGenerator::prepareFunctionBody;
+  targetGeneration->markTailCalls = &TargetGenerator::markTailCalls;
   targetGeneration->finishFunctionBody = &TargetGenerator::finishFunctionBody;
   targetGeneration->deleteFunction = &TargetGenerator::deleteFunction;
 
@@ -61,6 +65,8 @@ void TargetGenerator::initBindings()
   targetGeneration->generateCastIntToPointer = &TargetGenerator::generateCastIntToPointer;
   targetGeneration->generateCastPointerToInt = &TargetGenerator::generateCastPointerToInt;
   targetGeneration->generateCastPointerToPointer = &TargetGenerator::generateCastPointerToPointer;
+  targetGeneration->generateCastScalarToVector = &TargetGenerator::generateCastScalarToVector;
+  targetGeneration->generateCastVectorToVector = &TargetGenerator::generateCastVectorToVector;
 
   // Operation Generation Functions
   targetGeneration->generateVarReference = &TargetGenerator::generateVarReference;
@@ -102,6 +108,15 @@ void TargetGenerator::initBindings()
   targetGeneration->generateXorAssign = &TargetGenerator::generateXorAssign;
   targetGeneration->generateNextArg = &TargetGenerator::generateNextArg;
 
+  // Atomic Ops Generation Functions
+  targetGeneration->generateAtomicLoad = &TargetGenerator::generateAtomicLoad;
+  targetGeneration->generateAtomicStore = &TargetGenerator::generateAtomicStore;
+  targetGeneration->generateAtomicRmw = &TargetGenerator::generateAtomicRmw;
+  targetGeneration->generateAtomicCmpXchg = &TargetGenerator::generateAtomicCmpXchg;
+  targetGeneration->generateAtomicFence = &TargetGenerator::generateAtomicFence;
+  targetGeneration->generateVectorShuffle = &TargetGenerator::generateVectorShuffle;
+  targetGeneration->generateVectorReduce = &TargetGenerator::generateVectorReduce;
+
   // Comparison Ops Generation Functions
   targetGeneration->generateEqual = &TargetGenerator::generateEqual;
   targetGeneration->generateNotEqual = &TargetGenerator::generateNotEqual;
@@ -129,6 +144,7 @@ void TargetGenerator::setupBuild()
   this->blockIndex = 0;
   this->anonymousVarIndex = 0;
   this->vaStartEndFnType = 0;
+  this->stringLiteralPool.clear();
 
   this->buildTarget->setupBuild();
 }
@@ -200,6 +216,15 @@ Bool TargetGenerator::generateArrayType(TiObject *contentType, Word size, TioSha
 }
 
 
+Bool TargetGenerator::generateVectorType(TiObject *elementType, Word size, TioSharedPtr &type)
+{
+  PREPARE_ARG(elementType, elementTypeWrapper, Type);
+  auto llvmType = llvm::VectorType::get(elementTypeWrapper->getLlvmType(), size);
+  type = newSrdObj<VectorType>(llvmType, getSharedPtr(elementTypeWrapper), size);
+  return true;
+}
+
+
 Bool TargetGenerator::generateStructTypeDecl(
   Char const *name, TioSharedPtr &type
 ) {
@@ -318,6 +343,31 @@ Bool TargetGenerator::generateFunctionDecl(Char const *name, TiObject *functionT
 }
 
 
+Bool TargetGenerator::setFunctionAttributes(TiObject *function, Int attributes)
+{
+  PREPARE_ARG(function, funcWrapper, Function);
+
+  funcWrapper->attributes = attributes;
+  if (funcWrapper->getLlvmFunction() != 0) this->applyFunctionAttributes(funcWrapper, funcWrapper->getLlvmFunction());
+  return true;
+}
+
+
+Bool TargetGenerator::setFunctionArgNoAlias(TiObject *function, Char const *argName)
+{
+  VALIDATE_NOT_NULL(argName);
+  PREPARE_ARG(function, funcWrapper, Function);
+
+  auto index = funcWrapper->getFunctionType()->getArgs()->findIndex(argName);
+  if (index == -1) {
+    throw EXCEPTION(InvalidArgumentException, S("argName"), S("Function has no argument with the given name."), argName);
+  }
+  funcWrapper->noAliasArgs.push_back(index);
+  if (funcWrapper->getLlvmFunction() != 0) this->applyFunctionAttributes(funcWrapper, funcWrapper->getLlvmFunction());
+  return true;
+}
+
+
 Bool TargetGenerator::prepareFunctionBody(
   TiObject *function, TiObject *functionType, SharedList<TiObject> *args, TioSharedPtr &context
 ) {
@@ -335,6 +385,7 @@ Bool TargetGenerator::prepareFunctionBody(
       funcWrapper->getName().getBuf(), funcWrapper->llvmModule.get()
     );
     funcWrapper->setLlvmFunction(llvmFunc);
+    this->applyFunctionAttributes(funcWrapper, llvmFunc);
     llvmModule = funcWrapper->llvmModule.get();
   } else {
     llvmFunc = funcWrapper->getLlvmFunction();
@@ -387,6 +438,46 @@ Bool TargetGenerator::prepareFunctionBody(
 }
 
 
+Bool TargetGenerator::markTailCalls(TiObject *function, Bool &guaranteed)
+{
+  PREPARE_ARG(function, funcWrapper, Function);
+  auto llvmFunc = funcWrapper->getLlvmFunction();
+
+  // Find the self recursive calls that are directly returned. Any destructors that need to run after the call would
+  // have been generated between the call and the return, so those calls won't be picked up.
+  std::vector<llvm::CallInst*> llvmTailCalls;
+  Word selfCallCount = 0;
+  for (auto &llvmBlock : *llvmFunc) {
+    for (auto &llvmInst : llvmBlock) {
+      auto llvmCall = llvm::dyn_cast<llvm::CallInst>(&llvmInst);
+      if (llvmCall == 0 || llvmCall->getCalledFunction() != llvmFunc) continue;
+      ++selfCallCount;
+      auto llvmRet = llvm::dyn_cast_or_null<llvm::ReturnInst>(llvmCall->getNextNode());
+      if (llvmRet == 0) continue;
+      if (llvmRet->getReturnValue() != (llvmCall->getType()->isVoidTy() ? 0 : llvmCall)) continue;
+      llvmTailCalls.push_back(llvmCall);
+    }
+  }
+
+  // The callee reuses the caller's frame, so no pointer to the caller's local variables can be allowed to escape.
+  Bool frameEscapes = funcWrapper->getFunctionType()->isVariadic();
+  for (auto &llvmBlock : *llvmFunc) {
+    for (auto &llvmInst : llvmBlock) {
+      auto llvmAlloca = llvm::dyn_cast<llvm::AllocaInst>(&llvmInst);
+      if (llvmAlloca != 0 && this->doesAddressEscape(llvmAlloca)) frameEscapes = true;
+    }
+  }
+
+  if (frameEscapes) {
+    guaranteed = selfCallCount == 0;
+  } else {
+    for (auto llvmCall : llvmTailCalls) llvmCall->setTailCallKind(llvm::CallInst::TCK_MustTail);
+    guaranteed = llvmTailCalls.size() == selfCallCount;
+  }
+  return true;
+}
+
+
 Bool TargetGenerator::finishFunctionBody(
   TiObject *function, TiObject *functionType, DynamicContaining<TiObject> *args, TiObject *context
 ) {
@@ -503,6 +594,44 @@ Bool TargetGenerator::finishIfStatement(TiObject *context, CodeGen::IfTgContext
   PREPARE_ARG(ifTgContext, ifContext, IfContext);
   PREPARE_ARG(conditionVal, valWrapper, Value);
 
+  // A constant condition means one of the branches is dead, so jump directly to the live one. The dead branch is
+  // removed if it was skipped by the generator, otherwise it's kept as an unreachable block.
+  auto llvmConstCondition = llvm::dyn_cast<llvm::ConstantInt>(valWrapper->getLlvmValue());
+  if (llvmConstCondition != 0) {
+    Block *liveBlock = llvmConstCondition->isZero() ? ifContext->getElseBlock().get() : ifContext->getBodyBlock().get();
+    Block *deadBlock = llvmConstCondition->isZero() ? ifContext->getBodyBlock().get() : ifContext->getElseBlock().get();
+    if (
+      deadBlock != 0 &&
+      deadBlock->getLlvmBlock() == deadBlock->getLlvmEntryBlock() && deadBlock->getLlvmBlock()->empty()
+    ) {
+      deadBlock->getLlvmBlock()->eraseFromParent();
+      deadBlock = 0;
+    }
+    if (liveBlock == 0 && deadBlock == 0) return true;
+
+    llvm::BasicBlock *mergeLlvmBlock = 0;
+    if (
+      liveBlock == 0 || !liveBlock->isTerminated() ||
+      ifContext->getElseBlock() == 0 ||
+      (deadBlock != 0 && !deadBlock->isTerminated())
+    ) {
+      mergeLlvmBlock = llvm::BasicBlock::Create(
+        *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
+      );
+      if (liveBlock != 0 && !liveBlock->isTerminated()) liveBlock->getIrBuilder()->CreateBr(mergeLlvmBlock);
+      if (deadBlock != 0 && !deadBlock->isTerminated()) deadBlock->getIrBuilder()->CreateBr(mergeLlvmBlock);
+    }
+    block->getIrBuilder()->CreateBr(liveBlock != 0 ? liveBlock->getLlvmEntryBlock() : mergeLlvmBlock);
+
+    if (mergeLlvmBlock != 0) {
+      block->getIrBuilder()->SetInsertPoint(mergeLlvmBlock);
+      block->setLlvmBlock(mergeLlvmBlock);
+    } else {
+      block->setTerminated(true);
+    }
+    return true;
+  }
+
   // Create a merge block and jump to it from if and else bodies.
   llvm::BasicBlock *mergeLlvmBlock = 0;
   if (
@@ -818,6 +947,61 @@ Bool TargetGenerator::generateCastPointerToPointer(
 }
 
 
+Bool TargetGenerator::generateCastScalarToVector(
+  TiObject *context, TiObject *destType, TiObject *srcVal, TioSharedPtr &destVal
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVal, cgSrcVal, Value);
+  PREPARE_ARG(destType, destTypeWrapper, VectorType);
+  auto llvmCastedValue = block->getIrBuilder()->CreateVectorSplat(destTypeWrapper->getSize(), cgSrcVal->getLlvmValue());
+  destVal = newSrdObj<Value>(llvmCastedValue, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateCastVectorToVector(
+  TiObject *context, TiObject *srcType, TiObject *destType, TiObject *srcVal, TioSharedPtr &destVal
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVal, cgSrcVal, Value);
+  PREPARE_ARG(srcType, srcTypeWrapper, VectorType);
+  PREPARE_ARG(destType, destTypeWrapper, VectorType);
+  auto srcElementType = srcTypeWrapper->getElementType().get();
+  auto destElementType = destTypeWrapper->getElementType().get();
+  auto irBuilder = block->getIrBuilder();
+  auto llvmSrcVal = cgSrcVal->getLlvmValue();
+  auto llvmDestType = destTypeWrapper->getLlvmType();
+
+  llvm::Value *llvmCastedValue;
+  if (srcElementType->isDerivedFrom<IntegerType>()) {
+    Bool srcSigned = static_cast<IntegerType*>(srcElementType)->isSigned();
+    if (destElementType->isDerivedFrom<IntegerType>()) {
+      llvmCastedValue = irBuilder->CreateIntCast(llvmSrcVal, llvmDestType, srcSigned);
+    } else if (srcSigned) {
+      llvmCastedValue = irBuilder->CreateSIToFP(llvmSrcVal, llvmDestType);
+    } else {
+      llvmCastedValue = irBuilder->CreateUIToFP(llvmSrcVal, llvmDestType);
+    }
+  } else if (destElementType->isDerivedFrom<IntegerType>()) {
+    if (static_cast<IntegerType*>(destElementType)->isSigned()) {
+      llvmCastedValue = irBuilder->CreateFPToSI(llvmSrcVal, llvmDestType);
+    } else {
+      llvmCastedValue = irBuilder->CreateFPToUI(llvmSrcVal, llvmDestType);
+    }
+  } else {
+    auto srcSize = static_cast<FloatType*>(srcElementType)->getSize();
+    auto destSize = static_cast<FloatType*>(destElementType)->getSize();
+    if (srcSize > destSize) {
+      llvmCastedValue = irBuilder->CreateFPTrunc(llvmSrcVal, llvmDestType);
+    } else {
+      llvmCastedValue = irBuilder->CreateFPExt(llvmSrcVal, llvmDestType);
+    }
+  }
+  destVal = newSrdObj<Value>(llvmCastedValue, false);
+  return true;
+}
+
+
 //==============================================================================
 // Operation Generation Functions
 
@@ -944,6 +1128,7 @@ Bool TargetGenerator::generateFunctionPointer(
       funcWrapper->getFunctionType()->getLlvmFunctionType(), llvm::Function::ExternalLinkage,
       funcWrapper->getName().getBuf(), llvmMod
     );
+    this->applyFunctionAttributes(funcWrapper, llvmFunc);
   }
 
   // Generate the func pointer.
@@ -981,6 +1166,7 @@ Bool TargetGenerator::generateFunctionCall(
       funcWrapper->getFunctionType()->getLlvmFunctionType(), llvm::Function::ExternalLinkage,
       funcWrapper->getName().getBuf(), llvmMod
     );
+    this->applyFunctionAttributes(funcWrapper, llvmFunc);
   }
   // Create the call.
   auto llvmCall = block->getIrBuilder()->CreateCall(llvmFunc, args);
@@ -1143,7 +1329,8 @@ Bool TargetGenerator::generateAdd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1176,7 +1363,8 @@ Bool TargetGenerator::generateSub(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1210,7 +1398,8 @@ Bool TargetGenerator::generateMul(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1236,7 +1425,8 @@ Bool TargetGenerator::generateDiv(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1262,7 +1452,8 @@ Bool TargetGenerator::generateRem(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
 
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1289,7 +1480,8 @@ Bool TargetGenerator::generateShr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   llvm::Value *llvmResult;
   if (tgType->isSigned()) {
@@ -1308,7 +1500,8 @@ Bool TargetGenerator::generateShl(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateShl(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1322,7 +1515,8 @@ Bool TargetGenerator::generateAnd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateAnd(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1336,7 +1530,8 @@ Bool TargetGenerator::generateOr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateOr(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1350,7 +1545,8 @@ Bool TargetGenerator::generateXor(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateXor(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1363,7 +1559,8 @@ Bool TargetGenerator::generateNot(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
-  PREPARE_ARG(type, tgType, IntegerType);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateNot(srcValBox->getLlvmValue());
   result = newSrdObj<Value>(llvmResult, false);
@@ -1376,7 +1573,8 @@ Bool TargetGenerator::generateNeg(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateNeg(srcValBox->getLlvmValue());
     result = newSrdObj<Value>(llvmResult, false);
@@ -1647,6 +1845,182 @@ Bool TargetGenerator::generateNextArg(
 }
 
 
+//==============================================================================
+// Atomic Ops Generation Functions
+
+Bool TargetGenerator::generateAtomicLoad(
+  TiObject *context, TiObject *type, Int ordering, TiObject *srcVar, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVar, srcVarBox, Value);
+  PREPARE_ARG(type, tgType, Type);
+  auto llvmResult = block->getIrBuilder()->CreateLoad(srcVarBox->getLlvmValue());
+  llvmResult->setAtomic(this->getLlvmAtomicOrdering(ordering));
+  llvmResult->setAlignment(this->getAtomicAlignment(tgType));
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicStore(
+  TiObject *context, TiObject *type, Int ordering, TiObject *destVar, TiObject *srcVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(destVar, destVarBox, Value);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(type, tgType, Type);
+  auto llvmStore = block->getIrBuilder()->CreateStore(srcValBox->getLlvmValue(), destVarBox->getLlvmValue());
+  llvmStore->setAtomic(this->getLlvmAtomicOrdering(ordering));
+  llvmStore->setAlignment(this->getAtomicAlignment(tgType));
+  result = getSharedPtr(srcVal);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicRmw(
+  TiObject *context, TiObject *type, Int op, Int ordering, TiObject *destVar, TiObject *srcVal,
+  TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(destVar, destVarBox, Value);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(type, tgType, Type);
+
+  llvm::AtomicRMWInst::BinOp llvmOp;
+  switch (op) {
+    case CodeGen::AtomicRmwOp::ADD: llvmOp = llvm::AtomicRMWInst::Add; break;
+    case CodeGen::AtomicRmwOp::SUB: llvmOp = llvm::AtomicRMWInst::Sub; break;
+    case CodeGen::AtomicRmwOp::XCHG: llvmOp = llvm::AtomicRMWInst::Xchg; break;
+    case CodeGen::AtomicRmwOp::AND: llvmOp = llvm::AtomicRMWInst::And; break;
+    case CodeGen::AtomicRmwOp::OR: llvmOp = llvm::AtomicRMWInst::Or; break;
+    case CodeGen::AtomicRmwOp::XOR: llvmOp = llvm::AtomicRMWInst::Xor; break;
+    case CodeGen::AtomicRmwOp::MAX:
+    case CodeGen::AtomicRmwOp::MIN: {
+      // Min and max are only allowed on integers, and their comparison depends on the signedness.
+      PREPARE_ARG(type, intType, IntegerType);
+      if (op == CodeGen::AtomicRmwOp::MAX) {
+        llvmOp = intType->isSigned() ? llvm::AtomicRMWInst::Max : llvm::AtomicRMWInst::UMax;
+      } else {
+        llvmOp = intType->isSigned() ? llvm::AtomicRMWInst::Min : llvm::AtomicRMWInst::UMin;
+      }
+      break;
+    }
+    default: throw EXCEPTION(InvalidArgumentException, S("op"), S("Unknown atomic operation."), op);
+  }
+
+  auto llvmDestVar = destVarBox->getLlvmValue();
+  auto llvmSrcVal = srcValBox->getLlvmValue();
+  Bool isPointer = tgType->isDerivedFrom<PointerType>();
+  if (isPointer) {
+    // atomicrmw only accepts integers, so pointers are exchanged as integers of the same size.
+    auto llvmIntType = llvm::Type::getIntNTy(
+      *this->buildTarget->getLlvmContext(), this->buildTarget->getPointerBitCount()
+    );
+    llvmDestVar = block->getIrBuilder()->CreateBitCast(llvmDestVar, llvmIntType->getPointerTo());
+    llvmSrcVal = block->getIrBuilder()->CreatePtrToInt(llvmSrcVal, llvmIntType);
+  }
+  auto llvmRmw = block->getIrBuilder()->CreateAtomicRMW(
+    llvmOp, llvmDestVar, llvmSrcVal, this->getLlvmAtomicOrdering(ordering)
+  );
+  llvm::Value *llvmResult = llvmRmw;
+  if (isPointer) llvmResult = block->getIrBuilder()->CreateIntToPtr(llvmResult, tgType->getLlvmType());
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicCmpXchg(
+  TiObject *context, TiObject *type, Int successOrdering, Int failureOrdering, TiObject *destVar,
+  TiObject *cmpVal, TiObject *newVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(destVar, destVarBox, Value);
+  PREPARE_ARG(cmpVal, cmpValBox, Value);
+  PREPARE_ARG(newVal, newValBox, Value);
+  PREPARE_ARG(type, tgType, Type);
+  auto llvmCmpXchg = block->getIrBuilder()->CreateAtomicCmpXchg(
+    destVarBox->getLlvmValue(), cmpValBox->getLlvmValue(), newValBox->getLlvmValue(),
+    this->getLlvmAtomicOrdering(successOrdering), this->getLlvmAtomicOrdering(failureOrdering)
+  );
+  // The result is the value that was found in the variable, which equals cmpVal if the exchange happened.
+  auto llvmResult = block->getIrBuilder()->CreateExtractValue(llvmCmpXchg, 0);
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicFence(TiObject *context, Int ordering)
+{
+  PREPARE_ARG(context, block, Block);
+  block->getIrBuilder()->CreateFence(this->getLlvmAtomicOrdering(ordering));
+  return true;
+}
+
+
+//==============================================================================
+// Vector Ops Generation Functions
+
+Bool TargetGenerator::generateVectorShuffle(
+  TiObject *context, TiObject *type, TiObject *srcVal1, TiObject *srcVal2, std::vector<Int> const &mask,
+  TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVal1, srcValBox1, Value);
+  PREPARE_ARG(srcVal2, srcValBox2, Value);
+
+  std::vector<llvm::Constant*> llvmMask;
+  for (auto index : mask) {
+    llvmMask.push_back(llvm::ConstantInt::get(*this->buildTarget->getLlvmContext(), llvm::APInt(32, index, true)));
+  }
+  auto llvmResult = block->getIrBuilder()->CreateShuffleVector(
+    srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue(), llvm::ConstantVector::get(llvmMask)
+  );
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorReduce(
+  TiObject *context, TiObject *type, Int op, TiObject *srcVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(type, tgType, VectorType);
+  auto irBuilder = block->getIrBuilder();
+  auto llvmSrcVal = srcValBox->getLlvmValue();
+  auto elementType = tgType->getElementType().get();
+
+  llvm::Value *llvmResult;
+  if (elementType->isDerivedFrom<IntegerType>()) {
+    Bool isSigned = static_cast<IntegerType*>(elementType)->isSigned();
+    switch (op) {
+      case CodeGen::VectorReduceOp::ADD: llvmResult = irBuilder->CreateAddReduce(llvmSrcVal); break;
+      case CodeGen::VectorReduceOp::MUL: llvmResult = irBuilder->CreateMulReduce(llvmSrcVal); break;
+      case CodeGen::VectorReduceOp::MIN: llvmResult = irBuilder->CreateIntMinReduce(llvmSrcVal, isSigned); break;
+      case CodeGen::VectorReduceOp::MAX: llvmResult = irBuilder->CreateIntMaxReduce(llvmSrcVal, isSigned); break;
+      case CodeGen::VectorReduceOp::AND: llvmResult = irBuilder->CreateAndReduce(llvmSrcVal); break;
+      case CodeGen::VectorReduceOp::OR: llvmResult = irBuilder->CreateOrReduce(llvmSrcVal); break;
+      default: throw EXCEPTION(InvalidArgumentException, S("op"), S("Unexpected vector reduction."), op);
+    }
+  } else {
+    // Ordered float reductions need a start value, which is the identity of the operation.
+    switch (op) {
+      case CodeGen::VectorReduceOp::ADD:
+        llvmResult = irBuilder->CreateFAddReduce(llvm::ConstantFP::get(elementType->getLlvmType(), 0), llvmSrcVal);
+        break;
+      case CodeGen::VectorReduceOp::MUL:
+        llvmResult = irBuilder->CreateFMulReduce(llvm::ConstantFP::get(elementType->getLlvmType(), 1), llvmSrcVal);
+        break;
+      case CodeGen::VectorReduceOp::MIN: llvmResult = irBuilder->CreateFPMinReduce(llvmSrcVal); break;
+      case CodeGen::VectorReduceOp::MAX: llvmResult = irBuilder->CreateFPMaxReduce(llvmSrcVal); break;
+      default: throw EXCEPTION(InvalidArgumentException, S("op"), S("Unexpected vector reduction."), op);
+    }
+  }
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
 //==============================================================================
 // Comparison Ops Generation Functions
 
@@ -1656,7 +2030,8 @@ Bool TargetGenerator::generateEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpEQ(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     result = newSrdObj<Value>(llvmResult, false);
@@ -1677,7 +2052,8 @@ Bool TargetGenerator::generateNotEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpNE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
     result = newSrdObj<Value>(llvmResult, false);
@@ -1698,7 +2074,8 @@ Bool TargetGenerator::generateGreaterThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1724,7 +2101,8 @@ Bool TargetGenerator::generateGreaterThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1750,7 +2128,8 @@ Bool TargetGenerator::generateLessThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1776,7 +2155,8 @@ Bool TargetGenerator::generateLessThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
-  PREPARE_ARG(type, tgType, Type);
+  auto scalarType = this->getScalarType(type);
+  PREPARE_ARG(scalarType, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
     if (static_cast<IntegerType*>(tgType)->isSigned()) {
@@ -1832,25 +2212,47 @@ Bool TargetGenerator::generateStringLiteral(
   PREPARE_ARG(context, block, Block);
 
   Word len = getStrLen(value);
+  auto llvmStrType = static_cast<llvm::ArrayType*>(cgStrType->getLlvmType());
 
   // Prepare the llvm constant array.
-  std::vector<llvm::Constant*> llvmCharArray;
-  llvmCharArray.reserve(len + 1);
-  for (Word i = 0; i < len; i++) {
-    llvmCharArray.push_back(llvm::ConstantInt::get(cgCharType->getLlvmType(), value[i]));
+  llvm::Constant *llvmStrConst;
+  if (cgCharType->getLlvmType()->isIntegerTy(8)) {
+    llvmStrConst = llvm::ConstantDataArray::getString(
+      *this->buildTarget->getLlvmContext(), llvm::StringRef(value, len), true
+    );
+  } else {
+    std::vector<llvm::Constant*> llvmCharArray;
+    llvmCharArray.reserve(len + 1);
+    for (Word i = 0; i < len; i++) {
+      llvmCharArray.push_back(llvm::ConstantInt::get(cgCharType->getLlvmType(), value[i]));
+    }
+    llvmCharArray.push_back(llvm::ConstantInt::get(cgCharType->getLlvmType(), 0));
+    llvmStrConst = llvm::ConstantArray::get(llvmStrType, llvmCharArray);
   }
-  llvmCharArray.push_back(llvm::ConstantInt::get(cgCharType->getLlvmType(), 0));
 
-  // Create an anonymous global variable.
-  auto llvmStrConst = llvm::ConstantArray::get(static_cast<llvm::ArrayType*>(cgStrType->getLlvmType()), llvmCharArray);
+  // Reuse the global of an identical literal in the same module, if any. Constants are uniqued by LLVM, so comparing
+  // the initializers is enough to verify that the pooled global still belongs to an identical literal in this module.
   llvm::Module *llvmMod = this->perFunctionModules ?
     block->getFunction()->llvmModule.get() : this->buildTarget->getGlobalLlvmModule();
+  auto &literalPool = this->stringLiteralPool[llvmMod][cgCharType->getLlvmType()];
+  auto pooled = literalPool.find(std::string(value, len));
+  if (pooled != literalPool.end()) {
+    auto llvmVar = llvmMod->getNamedGlobal(pooled->second);
+    if (llvmVar != 0 && llvmVar->isConstant() && llvmVar->getInitializer() == llvmStrConst) {
+      destVal = newSrdObj<Value>(llvmVar, true);
+      return true;
+    }
+  }
+
+  // Create an anonymous global variable. Marking it unnamed_addr allows LLVM to merge it with identical constants.
   auto llvmVar = new llvm::GlobalVariable(
-    *llvmMod, cgStrType->getLlvmType(), true,
+    *llvmMod, llvmStrType, true,
     llvm::GlobalValue::PrivateLinkage, llvmStrConst, this->getAnonymouseVarName().c_str()
   );
+  llvmVar->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
   // TODO: Do we need this setAlignment call? It's marked as deprecated in LLVM 10.0.0.
   // llvmVar->setAlignment(1);
+  literalPool[std::string(value, len)] = llvmVar->getName().str();
 
   destVal = newSrdObj<Value>(llvmVar, true);
   return true;
@@ -1891,7 +2293,7 @@ Bool TargetGenerator::generateArrayLiteral(
   TiObject *context, TiObject *type, Containing<TiObject> *membersVals,
   TioSharedPtr &destVal
 ) {
-  PREPARE_ARG(type, tgType, ArrayType);
+  PREPARE_ARG(type, tgType, Type);
   VALIDATE_NOT_NULL(membersVals);
   std::vector<llvm::Constant*> arrayVals;
   for (Int i = 0; i < membersVals->getElementCount(); ++i) {
@@ -1901,7 +2303,12 @@ Bool TargetGenerator::generateArrayLiteral(
     }
     arrayVals.push_back(value->getLlvmConstant());
   }
-  auto llvmResult = llvm::ConstantArray::get(static_cast<llvm::ArrayType*>(tgType->getLlvmType()), arrayVals);
+  llvm::Constant *llvmResult;
+  if (tgType->isDerivedFrom<VectorType>()) {
+    llvmResult = llvm::ConstantVector::get(arrayVals);
+  } else {
+    llvmResult = llvm::ConstantArray::get(static_cast<llvm::ArrayType*>(tgType->getLlvmType()), arrayVals);
+  }
   destVal = newSrdObj<Value>(llvmResult, true);
   return true;
 }
@@ -1931,4 +2338,75 @@ std::string TargetGenerator::getAnonymouseVarName()
   return std::string("#anonymous") + std::to_string(this->anonymousVarIndex++);
 }
 
+
+llvm::Align TargetGenerator::getAtomicAlignment(Type *type)
+{
+  // Atomic instructions need an explicit alignment that is at least the size of the value.
+  return llvm::Align(this->buildTarget->getLlvmDataLayout()->getTypeStoreSize(type->getLlvmType()));
+}
+
+
+llvm::AtomicOrdering TargetGenerator::getLlvmAtomicOrdering(Int ordering)
+{
+  switch (ordering) {
+    case CodeGen::AtomicOrdering::RELAXED: return llvm::AtomicOrdering::Monotonic;
+    case CodeGen::AtomicOrdering::ACQUIRE: return llvm::AtomicOrdering::Acquire;
+    case CodeGen::AtomicOrdering::RELEASE: return llvm::AtomicOrdering::Release;
+    case CodeGen::AtomicOrdering::ACQ_REL: return llvm::AtomicOrdering::AcquireRelease;
+    case CodeGen::AtomicOrdering::SEQ_CST: return llvm::AtomicOrdering::SequentiallyConsistent;
+    default: throw EXCEPTION(InvalidArgumentException, S("ordering"), S("Unknown atomic ordering."), ordering);
+  }
+}
+
+
+void TargetGenerator::applyFunctionAttributes(Function *funcWrapper, llvm::Function *llvmFunc)
+{
+  // Declarations of the function in other modules get the same attributes so that callers can optimize around them.
+  auto attributes = funcWrapper->attributes;
+  if (attributes & CodeGen::FunctionAttributes::ALWAYS_INLINE) llvmFunc->addFnAttr(llvm::Attribute::AlwaysInline);
+  if (attributes & CodeGen::FunctionAttributes::NO_INLINE) llvmFunc->addFnAttr(llvm::Attribute::NoInline);
+  // LLVM 10 has no hot attribute, so we settle for an inlining hint.
+  if (attributes & CodeGen::FunctionAttributes::HOT) llvmFunc->addFnAttr(llvm::Attribute::InlineHint);
+  if (attributes & CodeGen::FunctionAttributes::COLD) llvmFunc->addFnAttr(llvm::Attribute::Cold);
+  // Calls are only merged by CSE if they neither write memory nor unwind.
+  if (attributes & CodeGen::FunctionAttributes::READ_NONE) {
+    llvmFunc->addFnAttr(llvm::Attribute::ReadNone);
+    llvmFunc->addFnAttr(llvm::Attribute::NoUnwind);
+  }
+  if (attributes & CodeGen::FunctionAttributes::READ_ONLY) {
+    llvmFunc->addFnAttr(llvm::Attribute::ReadOnly);
+    llvmFunc->addFnAttr(llvm::Attribute::NoUnwind);
+  }
+  for (auto index : funcWrapper->noAliasArgs) llvmFunc->addParamAttr(index, llvm::Attribute::NoAlias);
+}
+
+
+Bool TargetGenerator::doesAddressEscape(llvm::Value *llvmPtr)
+{
+  // Loading from or storing into the address is fine, but anything else could hand the address to someone else.
+  for (auto llvmUser : llvmPtr->users()) {
+    if (llvm::isa<llvm::LoadInst>(llvmUser)) continue;
+    auto llvmStore = llvm::dyn_cast<llvm::StoreInst>(llvmUser);
+    if (llvmStore != 0) {
+      if (llvmStore->getValueOperand() == llvmPtr) return true;
+      continue;
+    }
+    if (llvm::isa<llvm::GetElementPtrInst>(llvmUser) || llvm::isa<llvm::BitCastInst>(llvmUser)) {
+      if (this->doesAddressEscape(llvmUser)) return true;
+      continue;
+    }
+    return true;
+  }
+  return false;
+}
+
+
+TiObject* TargetGenerator::getScalarType(TiObject *type)
+{
+  // Vector ops are element-wise, so they are generated the same way as the ops of their element type.
+  auto vectorType = ti_cast<VectorType>(type);
+  if (vectorType != 0) return vectorType->getElementType().get();
+  else return type;
+}
+
 } // namespace
@@ -45,6 +45,11 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
   private: Int blockIndex = 0;
   private: Int anonymousVarIndex = 0;
 
+  /// The names of the string literal globals in each module, keyed by the char type and the content of the literal.
+  private: std::unordered_map<
+    llvm::Module*, std::unordered_map<llvm::Type*, std::unordered_map<std::string, std::string>>
+  > stringLiteralPool;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -103,6 +108,8 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: Bool generateArrayType(TiObject *contentType, Word size, TioSharedPtr &type);
 
+  public: Bool generateVectorType(TiObject *elementType, Word size, TioSharedPtr &type);
+
   public: Bool generateStructTypeDecl(
     Char const *name, TioSharedPtr &type
   );
@@ -129,10 +136,16 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     Char const *name, TiObject *functionType, TioSharedPtr &function
   );
 
+  public: Bool setFunctionAttributes(TiObject *function, Int attributes);
+
+  public: Bool setFunctionArgNoAlias(TiObject *function, Char const *argName);
+
   public: Bool prepareFunctionBody(
     TiObject *function, TiObject *functionType, SharedList<TiObject> *args, TioSharedPtr &context
   );
 
+  public: Bool markTailCalls(TiObject *function, Bool &guaranteed);
+
   public: Bool finishFunctionBody(
     TiObject *function, TiObject *functionType, DynamicContaining<TiObject> *args, TiObject *context
   );
@@ -202,6 +215,14 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     TiObject *context, TiObject *srcType, TiObject *destType, TiObject *srcVal, TioSharedPtr &destVal
   );
 
+  public: Bool generateCastScalarToVector(
+    TiObject *context, TiObject *destType, TiObject *srcVal, TioSharedPtr &destVal
+  );
+
+  public: Bool generateCastVectorToVector(
+    TiObject *context, TiObject *srcType, TiObject *destType, TiObject *srcVal, TioSharedPtr &destVal
+  );
+
   /// @}
 
   /// @name Operation Generation Functions
@@ -357,6 +378,43 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: Bool generateAtomicLoad(
+    TiObject *context, TiObject *type, Int ordering, TiObject *srcVar, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicStore(
+    TiObject *context, TiObject *type, Int ordering, TiObject *destVar, TiObject *srcVal, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicRmw(
+    TiObject *context, TiObject *type, Int op, Int ordering, TiObject *destVar, TiObject *srcVal,
+    TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicCmpXchg(
+    TiObject *context, TiObject *type, Int successOrdering, Int failureOrdering, TiObject *destVar,
+    TiObject *cmpVal, TiObject *newVal, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicFence(TiObject *context, Int ordering);
+
+  /// @}
+
+  /// @name Vector Ops Generation Functions
+  /// @{
+
+  public: Bool generateVectorShuffle(
+    TiObject *context, TiObject *type, TiObject *srcVal1, TiObject *srcVal2, std::vector<Int> const &mask,
+    TioSharedPtr &result
+  );
+
+  public: Bool generateVectorReduce(TiObject *context, TiObject *type, Int op, TiObject *srcVal, TioSharedPtr &result);
+
+  /// @}
+
   /// @name Comparison Ops Generation Functions
   /// @{
 
@@ -426,6 +484,16 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   private: std::string getAnonymouseVarName();
 
+  private: llvm::Align getAtomicAlignment(Type *type);
+
+  private: llvm::AtomicOrdering getLlvmAtomicOrdering(Int ordering);
+
+  private: void applyFunctionAttributes(Function *funcWrapper, llvm::Function *llvmFunc);
+
+  private: Bool doesAddressEscape(llvm::Value *llvmPtr);
+
+  private: TiObject* getScalarType(TiObject *type);
+
   /// @}
 
 }; // class
@@ -108,6 +108,8 @@ std::unique_ptr<ObjectLayer> JitEngine::createObjectLinkingLayer(JitEngineBuilde
     objLinkingLayer->setAutoClaimResponsibilityForObjectSymbols(true);
   }
 
+  for (auto listener : s.eventListeners) objLinkingLayer->registerJITEventListener(*listener);
+
   // FIXME: Explicit conversion to std::unique_ptr<ObjectLayer> added to silence
   //        errors from some GCC / libstdc++ bots. Remove this conversion (i.e.
   //        just return objLinkingLayer) once those bots are upgraded.
@@ -158,7 +160,7 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
       return;
     }
     compileLayer = std::make_unique<IRCompileLayer>(
-        *es, objTransformLayer, std::move(*compileFunction));
+        *es, objTransformLayer, std::make_unique<TimedIRCompiler>(std::move(*compileFunction)));
   }
 
   if (s.numCompileThreads > 0) {
@@ -196,6 +198,7 @@ std::unique_ptr<llvm::orc::IRTransformLayer> JitEngine::createOptimizeLayer(llvm
   optimizeLayer->setTransform(
     [&](llvm::orc::ThreadSafeModule tsm, const llvm::orc::MaterializationResponsibility &r) {
       tsm.withModuleDo([&](llvm::Module &module) {
+        Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::OPTIMIZATION);
         llvm::legacy::PassManager passes;
         passes.add(new llvm::TargetLibraryInfoWrapperPass(targetMachine->getTargetTriple()));
         passes.add(llvm::createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
@@ -220,12 +220,28 @@ class JitEngineBuilderState
   public: ObjectLinkingLayerCreator createObjectLinkingLayer;
   public: CompileFunctionCreator createCompileFunction;
   public: unsigned numCompileThreads = 0;
+  public: std::vector<llvm::JITEventListener*> eventListeners;
 
   /// Called prior to JIT class construcion to fix up defaults.
   public: llvm::Error prepareForConstruction();
 };
 
 
+//==============================================================================
+/// Wraps an IR compiler to charge the time it spends to the emission phase of the time report.
+class TimedIRCompiler : public llvm::orc::IRCompileLayer::IRCompiler {
+  private: std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> compiler;
+
+  public: TimedIRCompiler(std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> c)
+    : IRCompiler(c->getManglingOptions()), compiler(std::move(c)) {}
+
+  llvm::Expected<std::unique_ptr<llvm::MemoryBuffer>> operator()(llvm::Module &m) override {
+    Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::EMISSION);
+    return (*this->compiler)(m);
+  }
+};
+
+
 //==============================================================================
 class GlobalMappingGenerator : public llvm::orc::JITDylib::DefinitionGenerator {
   private: CodeGen::GlobalItemRepo *itemRepo;
@@ -236,14 +252,28 @@ class GlobalMappingGenerator : public llvm::orc::JITDylib::DefinitionGenerator {
     llvm::orc::LookupKind K, llvm::orc::JITDylib &JD, llvm::orc::JITDylibLookupFlags JDLookupFlags,
     const llvm::orc::SymbolLookupSet &Names
   ) {
-    llvm::orc::SymbolMap NewDefs;
+    // Resolve all the requested names in one go.
+    llvm::SmallVector<Char const*, 16> names;
+    llvm::SmallVector<Word, 16> lengths;
+    llvm::SmallVector<void*, 16> ptrs;
+    names.reserve(Names.size());
+    lengths.reserve(Names.size());
+    for (const auto &KV : Names) {
+      names.push_back((*KV.first).data());
+      lengths.push_back((*KV.first).size());
+    }
+    ptrs.resize(Names.size());
+    if (this->itemRepo->resolveItems(names.data(), lengths.data(), names.size(), ptrs.data()) == 0) {
+      return llvm::Error::success();
+    }
 
+    llvm::orc::SymbolMap NewDefs;
+    Word i = 0;
     for (const auto &KV : Names) {
-      const auto &Name = KV.first;
-      auto index = this->itemRepo->findItem((*Name).data());
-      if (index != -1) NewDefs[Name] = llvm::JITEvaluatedSymbol(
-        (llvm::JITTargetAddress)this->itemRepo->getItemPtr(index), llvm::JITSymbolFlags::None
+      if (ptrs[i] != 0) NewDefs[KV.first] = llvm::JITEvaluatedSymbol(
+        (llvm::JITTargetAddress)ptrs[i], llvm::JITSymbolFlags::None
       );
+      ++i;
     }
 
     cantFail(JD.define(absoluteSymbols(std::move(NewDefs))));
@@ -306,6 +336,13 @@ class JitEngineBuilderSetters
     return impl();
   }
 
+  /// Add a listener to be notified of the objects loaded by the default
+  /// RTDyldObjectLinkingLayer. Listeners aren't owned by the JIT.
+  public: SETTER_IMPL& addEventListener(llvm::JITEventListener *listener) {
+    impl().eventListeners.push_back(listener);
+    return impl();
+  }
+
   /// Create an instance of the JIT.
   public: llvm::Expected<std::unique_ptr<JIT_TYPE>> create(CodeGen::GlobalItemRepo *itemRepo) {
     if (auto err = impl().prepareForConstruction())
@@ -49,6 +49,7 @@ void llvmDiagnosticCallback(const llvm::DiagnosticInfo &di, void *context);
 
 // The Generator
 #include "jit_engines.h"
+#include "JitSymbolListener.h"
 #include "TargetGenerator.h"
 #include "BuildTarget.h"
 #include "JitBuildTarget.h"
@@ -134,6 +134,9 @@ DEFINE_NOTICE(InvalidTemplateArgNameNotice, "Spp.Notices", "Spp", "alusus.org",
 DEFINE_NOTICE(InvalidTemplateArgTypeNotice, "Spp.Notices", "Spp", "alusus.org", "SPPH1017", 1,
   "Invalid templatae arg type."
 );
+DEFINE_NOTICE(InvalidAtomicFenceStatementNotice, "Spp.Notices", "Spp", "alusus.org", "SPPH1018", 1,
+  "Invalid atomic_fence statement."
+);
 
 } // namespace
 
@@ -258,6 +261,36 @@ DEFINE_NOTICE(IncompleteInfixOpNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG
 DEFINE_NOTICE(IncompleteOutfixOpNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1038", 1,
   "Incomplete prefix or postfix operator. This is likely caused by a macro or an eval statement that evaluated to null."
 );
+DEFINE_NOTICE(InvalidAtomicOperandNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1039", 1,
+  "Invalid operand for atomic operation. Atomic operations need a variable of a pointer type or an integer type of "
+  "8, 16, 32, or 64 bits."
+);
+DEFINE_NOTICE(InvalidAtomicArgsNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1040", 1,
+  "Invalid arguments for atomic operation."
+);
+DEFINE_NOTICE(InvalidVectorElementTypeNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1041", 1,
+  "Invalid vector element type. Vectors can only hold integers or floats."
+);
+DEFINE_NOTICE(InvalidVectorOperandNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1042", 1,
+  "Invalid operand for vector operation."
+);
+DEFINE_NOTICE(InvalidVectorArgsNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1043", 1,
+  "Invalid arguments for vector operation."
+);
+DEFINE_NOTICE(InvalidAtomicOrderingNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1044", 1,
+  "Invalid memory ordering for this atomic operation."
+);
+DEFINE_NOTICE(ConflictingFunctionModifiersNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1045", 1,
+  "Conflicting function modifiers. A function can't be both inline and noinline, hot and cold, or pure and readonly."
+);
+DEFINE_NOTICE(InvalidNoAliasModifierNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1046", 1,
+  "Invalid noalias modifier. The modifier takes the names of pointer arguments of the function."
+);
+DEFINE_NOTICE(TailCallNotGuaranteedNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1047", 1,
+  "Recursive calls in this function can't be guaranteed to be tail calls. A recursive call needs to be returned "
+  "directly with no variables left to destruct, and the function can't take the pointer of any of its local "
+  "variables."
+);
 
 } // namespace
 
@@ -26,7 +26,10 @@ RootScopeHandlerExtension::Overrides* RootScopeHandlerExtension::extend(
 
   auto overrides = new Overrides();
   extension->rootManagerBox = Box<Core::Main::RootManager*>::create(rootManager);
+  extension->pendingStartBox = TiInt::create(-1);
   overrides->addNewElementRef = handler->addNewElement.set(&RootScopeHandlerExtension::_addNewElement).get();
+  overrides->flushPendingElementsRef =
+    handler->flushPendingElements.set(&RootScopeHandlerExtension::_flushPendingElements).get();
 
   return overrides;
 }
@@ -36,7 +39,9 @@ void RootScopeHandlerExtension::unextend(Core::Main::RootScopeHandler *handler,
 {
   auto extension = ti_cast<RootScopeHandlerExtension>(handler);
   handler->addNewElement.reset(overrides->addNewElementRef);
+  handler->flushPendingElements.reset(overrides->flushPendingElementsRef);
   extension->rootManagerBox.remove();
+  extension->pendingStartBox.remove();
   handler->removeDynamicInterface<RootScopeHandlerExtension>();
   delete overrides;
 }
@@ -68,48 +73,89 @@ void RootScopeHandlerExtension::_addNewElement(
   if (execute) {
     PREPARE_SELF(extension, RootScopeHandlerExtension);
     auto rootManager = extension->rootManagerBox->get();
-    auto rootManagerExt = ti_cast<RootManagerExtension>(rootManager);
+    if (rootManager->isBatchExecution() && !rootManager->isInteractive()) {
+      // Defer the execution until the pending statements get flushed.
+      if (extension->pendingStartBox->get() == -1) extension->pendingStartBox->set(start);
+    } else {
+      RootScopeHandlerExtension::executeElements(self, start, false, parser, state);
+    }
+  }
+}
 
-    // Prepare rtAstMgr & rtBuildMgr
-    rootManagerExt->rtAstMgr->setParser(parser);
-    rootManagerExt->rtAstMgr->setNoticeStore(state->getNoticeStore());
-    rootManagerExt->rtBuildMgr->setParser(parser);
-    rootManagerExt->rtBuildMgr->setNoticeStore(state->getNoticeStore());
 
-    // Process macros.
-    auto astProcessor = rootManagerExt->astProcessor.get();
-    astProcessor->preparePass(state->getNoticeStore());
-    if (!astProcessor->process(root)) return;
+void RootScopeHandlerExtension::_flushPendingElements(
+  TiFunctionBase *base, TiObject *self, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+) {
+  PREPARE_SELF(extension, RootScopeHandlerExtension);
+  Int start = extension->pendingStartBox->get();
+  if (start == -1) return;
+  // Reset the pending index before executing since the executed statements may end up processing other sources
+  // (through runtime imports, for example), and those should be batched and flushed separately.
+  extension->pendingStartBox->set(-1);
+  RootScopeHandlerExtension::executeElements(self, start, true, parser, state);
+}
 
-    auto executing = ti_cast<Executing>(rootManagerExt->buildManager.get());
 
-    SharedPtr<BuildSession> buildSession = executing->prepareBuild(
-      state->getNoticeStore(), BuildManager::BuildType::JIT, rootManager->getRootScope().get()
-    );
+void RootScopeHandlerExtension::executeElements(
+  TiObject *self, Int start, Bool batch, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+) {
+  PREPARE_SELF(rootScopeHandler, Core::Main::RootScopeHandler);
+  PREPARE_SELF(extension, RootScopeHandlerExtension);
+  auto root = rootScopeHandler->getRootScope().get();
+  auto end = root->getCount() - 1;
 
-    Bool execute = true;
+  auto rootManager = extension->rootManagerBox->get();
+  auto rootManagerExt = ti_cast<RootManagerExtension>(rootManager);
 
-    // First, let's run all the modules initializations.
-    for (Int i = 0; i < start; ++i) {
-      auto def = ti_cast<Core::Data::Ast::Definition>(root->get(i));
-      if (def != 0) {
-        auto module = def->getTarget().ti_cast_get<Spp::Ast::Module>();
-        if (module != 0) {
-          if (!executing->addElementToBuild(def.get(), buildSession.get())) execute = false;
-        }
+  // Prepare rtAstMgr & rtBuildMgr
+  rootManagerExt->rtAstMgr->setParser(parser);
+  rootManagerExt->rtAstMgr->setNoticeStore(state->getNoticeStore());
+  rootManagerExt->rtBuildMgr->setParser(parser);
+  rootManagerExt->rtBuildMgr->setNoticeStore(state->getNoticeStore());
+
+  // Process macros.
+  auto astProcessor = rootManagerExt->astProcessor.get();
+  astProcessor->preparePass(state->getNoticeStore());
+  if (!astProcessor->process(root)) return;
+
+  auto executing = ti_cast<Executing>(rootManagerExt->buildManager.get());
+
+  SharedPtr<BuildSession> buildSession = executing->prepareBuild(
+    state->getNoticeStore(), BuildManager::BuildType::JIT, rootManager->getRootScope().get()
+  );
+
+  Bool execute = true;
+
+  // First, let's run all the modules initializations.
+  for (Int i = 0; i < start; ++i) {
+    auto def = ti_cast<Core::Data::Ast::Definition>(root->get(i));
+    if (def != 0) {
+      auto module = def->getTarget().ti_cast_get<Spp::Ast::Module>();
+      if (module != 0) {
+        if (!executing->addElementToBuild(def.get(), buildSession.get())) execute = false;
       }
     }
+  }
 
-    // Now run all new statements.
-    for (Int i = start; i <= end; ++i) {
-      auto childData = root->get(i);
-      if (!executing->addElementToBuild(childData.get(), buildSession.get())) execute = false;
+  // Now run all new statements.
+  for (Int i = start; i <= end; ++i) {
+    auto childData = root->get(i);
+    if (batch) {
+      // Definitions parsed in between batched statements are not executed, except for the initialization of
+      // modules, which would have otherwise been done before the execution of the statements that follow them.
+      auto def = ti_cast<Core::Data::Ast::Definition>(childData);
+      if (def != 0) {
+        if (def->getTarget().ti_cast_get<Spp::Ast::Module>() == 0) continue;
+      } else if (childData == 0 || childData->isDerivedFrom<Core::Data::Ast::Bridge>()) {
+        continue;
+      }
     }
+    if (!executing->addElementToBuild(childData.get(), buildSession.get())) execute = false;
+  }
 
-    executing->finalizeBuild(state->getNoticeStore(), rootManager->getRootScope().get(), buildSession.get());
-    if (execute) {
-      executing->execute(state->getNoticeStore(), buildSession.get());
-    }
+  executing->finalizeBuild(state->getNoticeStore(), rootManager->getRootScope().get(), buildSession.get());
+  if (execute) {
+    executing->execute(state->getNoticeStore(), buildSession.get());
   }
 }
 
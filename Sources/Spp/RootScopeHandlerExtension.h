@@ -30,6 +30,7 @@ class RootScopeHandlerExtension : public ObjTiInterface
   public: struct Overrides
   {
     TiFunctionBase *addNewElementRef;
+    TiFunctionBase *flushPendingElementsRef;
   };
 
 
@@ -46,6 +47,7 @@ class RootScopeHandlerExtension : public ObjTiInterface
   {
     Basic::initBindingCaches(this->owner, {
       &this->rootManagerBox,
+      &this->pendingStartBox
     });
   }
 
@@ -55,6 +57,9 @@ class RootScopeHandlerExtension : public ObjTiInterface
 
   public: BINDING_CACHE(rootManagerBox, Box<Core::Main::RootManager*>);
 
+  /// The index of the first root element that is waiting to be executed, or -1 if none is pending.
+  public: BINDING_CACHE(pendingStartBox, TiInt);
+
 
   //============================================================================
   // Member Functions
@@ -92,6 +97,14 @@ class RootScopeHandlerExtension : public ObjTiInterface
     Core::Processing::Parser *parser, Core::Processing::ParserState *state
   );
 
+  private: static void _flushPendingElements(
+    TiFunctionBase *base, TiObject *self, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+  );
+
+  private: static void executeElements(
+    TiObject *self, Int start, Bool batch, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+  );
+
   /// @}
 
 }; // class
@@ -21,7 +21,8 @@ void BuildMgr::initBindingCaches()
 {
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
-    &this->buildObjectFileForElement
+    &this->buildObjectFileForElement,
+    &this->buildObjectFileForElementWithOptions
   });
 }
 
@@ -30,6 +31,7 @@ void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->buildObjectFileForElementWithOptions = &BuildMgr::_buildObjectFileForElementWithOptions;
 }
 
 
@@ -38,6 +40,9 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
   globalItemRepo->addItem(S("!Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFileForElementWithOptions"), (void*)&BuildMgr::_buildObjectFileForElementWithOptions
+  );
 }
 
 
@@ -56,7 +61,18 @@ Bool BuildMgr::_buildObjectFileForElement(
 ) {
   PREPARE_SELF(buildMgr, BuildMgr);
   return buildMgr->buildManager->buildObjectFileForElement(
-    element, objectFilename, targetTriple, buildMgr->noticeStore, buildMgr->parser
+    element, objectFilename, targetTriple, 0, buildMgr->noticeStore, buildMgr->parser
+  );
+}
+
+
+Bool BuildMgr::_buildObjectFileForElementWithOptions(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  BuildOptions const *options
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, options, buildMgr->noticeStore, buildMgr->parser
   );
 }
 
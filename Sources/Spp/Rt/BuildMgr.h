@@ -109,6 +109,14 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
     TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
   );
 
+  public: METHOD_BINDING_CACHE(buildObjectFileForElementWithOptions,
+    Bool, (TiObject*, Char const*, Char const*, BuildOptions const*)
+  );
+  public: static Bool _buildObjectFileForElementWithOptions(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    BuildOptions const *options
+  );
+
   /// @}
 
 }; // class
@@ -87,6 +87,7 @@ Core::Data::Seeker::Verb SeekerExtension::_foreach(
   TiFunctionBase *base, TiObject *self, TiObject const *ref, TiObject *target,
   Core::Data::Seeker::ForeachCallback const &cb, Word flags
 ) {
+  Core::Main::TimeReport::Scope timeScope(Core::Main::TimeReport::Phase::SEEKING);
   if (ref->isA<Data::Ast::ParamPass>()) {
     PREPARE_SELF(seekerExtension, SeekerExtension);
     return seekerExtension->foreachByParamPass(static_cast<Data::Ast::ParamPass const*>(ref), target, cb, flags);
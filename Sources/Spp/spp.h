@@ -51,6 +51,7 @@ namespace Spp
 
 #include "ExecutionContext.h"
 #include "DependencyList.h"
+#include "BuildOptions.h"
 #include "Executing.h"
 
 #include "Ast/ast.h"
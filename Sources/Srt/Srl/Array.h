@@ -24,25 +24,25 @@ template <class T> class ArrayData
   public: ArchInt refCount;
   public: ArchInt length;
   public: ArchInt bufSize;
+  public: Allocator *allocator;
   public: T buf[1];
 
   //=================
   // Member Functions
 
-  public: static ArrayData<T>* alloc(ArchInt size) {
+  public: static ArrayData<T>* alloc(ArchInt size, Allocator *allocator = 0) {
     if (size < 2) size = 2;
-    ArchInt byteCount = sizeof(ArrayData<T>) + sizeof(T) * (size - 1);
-    ArrayData<T> *data = (ArrayData<T>*)malloc(byteCount);
+    ArrayData<T> *data = (ArrayData<T>*)allocate(allocator, getByteCount(size));
     data->bufSize = size;
     data->length = 0;
     data->refCount = 1;
+    data->allocator = allocator;
     return data;
   }
 
   public: static ArrayData<T>* realloc(ArrayData<T> *data, ArchInt newSize) {
     if (newSize < 2) newSize = 2;
-    ArchInt byteCount = sizeof(ArrayData<T>) + sizeof(T) * (newSize - 1);
-    data = (ArrayData<T>*)::realloc(data, byteCount);
+    data = (ArrayData<T>*)reallocate(data->allocator, data, getByteCount(data->bufSize), getByteCount(newSize));
     data->bufSize = newSize;
     return data;
   }
@@ -50,7 +50,11 @@ template <class T> class ArrayData
   public: static void release(ArrayData<T> *data) {
     ArchInt i;
     for (i = 0; i < data->length; ++i) data->buf[i].~T();
-    free(data);
+    deallocate(data->allocator, data);
+  }
+
+  private: static ArchInt getByteCount(ArchInt size) {
+    return sizeof(ArrayData<T>) + sizeof(T) * (size - 1);
   }
 };
 
@@ -134,7 +138,7 @@ template <class T> class Array
     } else {
       ArrayData<T> *curData = this->data;
       --this->data->refCount;
-      this->data = ArrayData<T>::alloc(curData->length + curData->length >> 1);
+      this->data = ArrayData<T>::alloc(curData->length + curData->length >> 1, curData->allocator);
       ArchInt i;
       for (i = 0; i < curData->length; ++i) new(this->data->buf + i) T(curData->buf[i]);
       this->data->length = curData->length;
@@ -152,7 +156,7 @@ template <class T> class Array
       this->add(item);
     } else {
       this->_prepareToModify(true);
-      memcpy(this->data->buf + index + 1, this->data->buf + index, sizeof(T) * (this->data->length - index));
+      memmove(this->data->buf + index + 1, this->data->buf + index, sizeof(T) * (this->data->length - index));
       new(this->data->buf + index) T(item);
       ++this->data->length;
     }
@@ -163,7 +167,7 @@ template <class T> class Array
       this->_prepareToModify(false);
       this->data->buf[index].~T();
       if (index < this->getLength() - 1) {
-        memcpy(this->data->buf + index, this->data->buf + index + 1, sizeof(T) * (this->data->length - (index + 1)));
+        memmove(this->data->buf + index, this->data->buf + index + 1, sizeof(T) * (this->data->length - (index + 1)));
       };
       --this->data->length;
     }
@@ -0,0 +1,298 @@
+/**
+ * @file Srl/HashMap.h
+ * Contains the Srl::HashMap type.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SRL_HASHMAP_H
+#define SRL_HASHMAP_H
+
+namespace Srl
+{
+
+//==============================================================================
+// Hash Functions
+// Custom key types can be supported by adding more overloads of `hash`.
+
+inline PtrWord hash(LongInt key) {
+  // The finalizer of SplitMix64, which spreads the entropy to the lower bits used by the table.
+  PtrWord h = (PtrWord)key;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ul;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebul;
+  return h ^ (h >> 31);
+}
+
+inline PtrWord hash(void const *key) {
+  return hash((LongInt)key);
+}
+
+template<class T> PtrWord hashChars(T const *chars) {
+  // FNV-1a.
+  PtrWord h = 0xcbf29ce484222325ul;
+  for (T const *c = chars; *c != 0; ++c) {
+    h = (h ^ (PtrWord)*c) * 0x100000001b3ul;
+  }
+  return h;
+}
+
+// These are not templates so that classes derived from strings pick them rather than the pointer overload.
+inline PtrWord hash(StringBase<Char> const &key) {
+  return hashChars(key.getBuf());
+}
+
+inline PtrWord hash(StringBase<WChar> const &key) {
+  return hashChars(key.getBuf());
+}
+
+
+//==============================================================================
+// HashMap
+
+/**
+ * @brief A map that finds its keys in constant time using a hash table.
+ * @ingroup srl
+ *
+ * Keys and values are kept in insertion order in two arrays, which allows
+ * iterating the map by index, while a separate open addressing table of slots
+ * maps hashes to the indexes in those arrays. Collisions are resolved using
+ * Robin Hood probing. Removing an item moves the last item into the position
+ * of the removed one.
+ */
+template<class T1, class T2> class HashMap {
+  //=================
+  // Types
+
+  private: struct Slot {
+    PtrWord hash;
+    ArchInt index;
+  };
+
+  //=================
+  // Member Variables
+
+  private: Array<T1> keys;
+  private: Array<T2> values;
+  private: Slot *slots;
+  private: ArchInt slotCount;
+
+  //===============
+  // Initialization
+
+  public: HashMap() : slots(0), slotCount(0) {
+  }
+
+  public: HashMap(HashMap<T1, T2> const &map) : slots(0), slotCount(0) {
+    this->assign(map);
+  }
+
+  public: ~HashMap() {
+    if (this->slots != 0) free(this->slots);
+  }
+
+  //==========
+  // Operators
+
+  public: HashMap<T1, T2>& operator=(HashMap<T1, T2> const &map) {
+    this->assign(map);
+    return *this;
+  }
+
+  public: T2& operator()(T1 const &key) {
+    ArchInt i = this->findPos(key);
+    if (i == -1) {
+      i = this->keys.getLength();
+      this->add(key, T2());
+    }
+    return this->values(i);
+  }
+
+  //=================
+  // Member Functions
+
+  public: void assign(HashMap<T1, T2> const &map) {
+    if (this == &map) return;
+    this->keys = map.keys;
+    this->values = map.values;
+    if (this->slots != 0) free(this->slots);
+    this->slotCount = map.slotCount;
+    if (map.slots == 0) {
+      this->slots = 0;
+    } else {
+      this->slots = (Slot*)malloc(sizeof(Slot) * this->slotCount);
+      memcpy(this->slots, map.slots, sizeof(Slot) * this->slotCount);
+    }
+  }
+
+  public: void reserve(ArchInt size) {
+    this->keys.reserve(size);
+    this->values.reserve(size);
+    ArchInt slotCount = 8;
+    while (slotCount * 3 < size * 4) slotCount *= 2;
+    if (slotCount > this->slotCount) this->resize(slotCount);
+  }
+
+  public: T1 const& keyAt(ArchInt i) const {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->keys(i);
+  }
+
+  public: T2& valAt(ArchInt i) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->values(i);
+  }
+
+  public: T2 const& valAt(ArchInt i) const {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    return this->values(i);
+  }
+
+  public: HashMap<T1, T2>& set(T1 const &key, T2 const &value) {
+    ArchInt pos = this->findPos(key);
+    if (pos == -1) this->add(key, value);
+    else this->values(pos) = value;
+    return *this;
+  }
+
+  public: HashMap<T1, T2>& setAt(ArchInt i, T2 const &value) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    this->values(i) = value;
+    return *this;
+  }
+
+  public: Bool remove(T1 const &key) {
+    ArchInt pos = this->findPos(key);
+    if (pos == -1) return false;
+    this->removeAt(pos);
+    return true;
+  }
+
+  public: void removeAt(ArchInt i) {
+    if (i < 0 || i >= this->keys.getLength()) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range."), i);
+    }
+    this->removeSlot(this->findSlotOfIndex(i));
+    ArchInt last = this->keys.getLength() - 1;
+    if (i != last) {
+      // Move the last item into the removed position to keep the arrays dense.
+      this->slots[this->findSlotOfIndex(last)].index = i;
+      this->keys(i) = this->keys(last);
+      this->values(i) = this->values(last);
+    }
+    this->keys.remove(last);
+    this->values.remove(last);
+  }
+
+  public: void clear() {
+    this->keys.clear();
+    this->values.clear();
+    if (this->slots != 0) memset(this->slots, -1, sizeof(Slot) * this->slotCount);
+  }
+
+  public: ArchInt getLength() const {
+    return this->keys.getLength();
+  }
+
+  public: ArchInt findPos(T1 const &key) const {
+    if (this->slotCount == 0) return -1;
+    PtrWord h = hash(key);
+    PtrWord mask = this->slotCount - 1;
+    PtrWord pos = h & mask;
+    for (PtrWord dist = 0;; ++dist) {
+      Slot const &slot = this->slots[pos];
+      if (slot.index == -1) return -1;
+      // With Robin Hood probing the key can't be further than the point where existing entries are closer to their
+      // home slots than we are to ours.
+      if (((pos - (slot.hash & mask)) & mask) < dist) return -1;
+      if (slot.hash == h && this->keys(slot.index) == key) return slot.index;
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  public: Array<T1> getKeys() const {
+    return this->keys;
+  }
+
+  public: Array<T2> getValues() const {
+    return this->values;
+  }
+
+  private: void add(T1 const &key, T2 const &value) {
+    if ((this->keys.getLength() + 1) * 4 > this->slotCount * 3) {
+      this->resize(this->slotCount == 0 ? 8 : this->slotCount * 2);
+    }
+    this->insertSlot(hash(key), this->keys.getLength());
+    this->keys.add(key);
+    this->values.add(value);
+  }
+
+  private: void resize(ArchInt slotCount) {
+    if (this->slots != 0) free(this->slots);
+    this->slotCount = slotCount;
+    this->slots = (Slot*)malloc(sizeof(Slot) * slotCount);
+    memset(this->slots, -1, sizeof(Slot) * slotCount);
+    for (ArchInt i = 0; i < this->keys.getLength(); ++i) this->insertSlot(hash(this->keys(i)), i);
+  }
+
+  private: void insertSlot(PtrWord h, ArchInt index) {
+    PtrWord mask = this->slotCount - 1;
+    PtrWord pos = h & mask;
+    for (PtrWord dist = 0;; ++dist) {
+      Slot &slot = this->slots[pos];
+      if (slot.index == -1) {
+        slot.hash = h;
+        slot.index = index;
+        return;
+      }
+      // Take the slot from entries that are closer to their home slots than we are.
+      PtrWord slotDist = (pos - (slot.hash & mask)) & mask;
+      if (slotDist < dist) {
+        PtrWord tempHash = slot.hash;
+        ArchInt tempIndex = slot.index;
+        slot.hash = h;
+        slot.index = index;
+        h = tempHash;
+        index = tempIndex;
+        dist = slotDist;
+      }
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  private: PtrWord findSlotOfIndex(ArchInt index) const {
+    PtrWord mask = this->slotCount - 1;
+    PtrWord pos = hash(this->keys(index)) & mask;
+    while (this->slots[pos].index != index) pos = (pos + 1) & mask;
+    return pos;
+  }
+
+  private: void removeSlot(PtrWord pos) {
+    // Shift the following entries back until we reach an empty slot or an entry in its home slot.
+    PtrWord mask = this->slotCount - 1;
+    PtrWord next = (pos + 1) & mask;
+    while (this->slots[next].index != -1 && ((next - (this->slots[next].hash & mask)) & mask) != 0) {
+      this->slots[pos] = this->slots[next];
+      pos = next;
+      next = (next + 1) & mask;
+    }
+    this->slots[pos].index = -1;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
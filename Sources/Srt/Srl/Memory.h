@@ -0,0 +1,57 @@
+/**
+ * @file Srl/Memory.h
+ * Contains the Srl::Allocator interface.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SRL_MEMORY_H
+#define SRL_MEMORY_H
+
+namespace Srl
+{
+
+/**
+ * @brief An interface for custom allocators.
+ * @ingroup srl
+ *
+ * Containers created in Alusus code with a custom allocator keep a pointer to
+ * it in their data and all changes to that data, including those done from
+ * C++, must go through it. Its layout must match that of Srl.Memory.Allocator
+ * in Memory.alusus.
+ */
+struct Allocator
+{
+  void* (*allocFunc)(Allocator *allocator, ArchInt size);
+  void* (*reallocFunc)(Allocator *allocator, void *p, ArchInt oldSize, ArchInt newSize);
+  void (*freeFunc)(Allocator *allocator, void *p);
+};
+
+
+/// Allocates from the given allocator, or from the heap if the allocator is null.
+inline void* allocate(Allocator *allocator, ArchInt size)
+{
+  if (allocator == 0) return malloc(size);
+  else return allocator->allocFunc(allocator, size);
+}
+
+inline void* reallocate(Allocator *allocator, void *p, ArchInt oldSize, ArchInt newSize)
+{
+  if (allocator == 0) return realloc(p, newSize);
+  else return allocator->reallocFunc(allocator, p, oldSize, newSize);
+}
+
+inline void deallocate(Allocator *allocator, void *p)
+{
+  if (allocator == 0) free(p);
+  else allocator->freeFunc(allocator, p);
+}
+
+} // namespace
+
+#endif
@@ -123,12 +123,14 @@ typedef unsigned long int PtrWord;
 
 // Alusus Srl header files
 
+#include "Memory.h"
 #include "Array.h"
 #include "refs.h"
 #include "strs.h"
 #include "exceptions.h"
 #include "ArrayIndex.h"
 #include "Map.h"
+#include "HashMap.h"
 
 // Since basic datatypes should be available everywhere, we'll just open up the namespace.
 using namespace Srl;
@@ -16,12 +16,28 @@
 namespace Srl
 {
 
+/**
+ * @brief The header allocated along with the buffer of a string.
+ * @ingroup srl
+ *
+ * This header is shared between all copies of a string. Its layout must match
+ * that of Srl.StringBaseHeader in StringBase.alusus.
+ */
+struct StringBaseHeader
+{
+  Int refCount;
+  LongInt length;
+  LongInt capacity;
+  Allocator *allocator;
+};
+
 template<class T> class StringBase
 {
   //=================
   // Member Variables
 
-  private: Int *refCount;
+  // Strings that don't own their buffers have no header.
+  private: StringBaseHeader *header;
   private: T *buf;
 
   //==========================
@@ -65,93 +81,105 @@ template<class T> class StringBase
   private: void _init() {
     static T strTerminator(0);
     this->buf = &strTerminator;
-    this->refCount = 0;
+    this->header = 0;
   }
 
-  private: void _alloc(LongInt length) {
-    this->refCount = (Int*)malloc(sizeof(Int) + sizeof(T) * (length + 1));
-    this->buf = (T*)((ArchInt)this->refCount + sizeof(*this->refCount));
-    *this->refCount = 1;
+  private: void _alloc(LongInt capacity, Allocator *allocator = 0) {
+    if (capacity < 0) capacity = 0;
+    this->header = (StringBaseHeader*)allocate(allocator, sizeof(StringBaseHeader) + sizeof(T) * (capacity + 1));
+    this->buf = (T*)(this->header + 1);
+    this->buf[0] = 0;
+    this->header->refCount = 1;
+    this->header->length = 0;
+    this->header->capacity = capacity;
+    this->header->allocator = allocator;
   }
 
-  private: void _realloc(LongInt newLength) {
-    this->refCount = (Int*)realloc(this->refCount, sizeof(Int) + sizeof(T) * (newLength + 1));
-    this->buf = (T*)((ArchInt)this->refCount + sizeof(*this->refCount));
+  private: void _grow(LongInt length) {
+    if (length <= this->header->capacity) return;
+    // Grow geometrically to keep appending in a loop linear.
+    LongInt capacity = this->header->capacity + (this->header->capacity >> 1);
+    if (capacity < length) capacity = length;
+    this->header = (StringBaseHeader*)reallocate(
+      this->header->allocator, this->header, sizeof(StringBaseHeader) + sizeof(T) * (this->header->capacity + 1),
+      sizeof(StringBaseHeader) + sizeof(T) * (capacity + 1)
+    );
+    this->buf = (T*)(this->header + 1);
+    this->header->capacity = capacity;
   }
 
   private: void _release() {
-    if (this->refCount != 0) {
-      --*this->refCount;
-      if (*this->refCount == 0) free(this->refCount);
+    if (this->header != 0) {
+      --this->header->refCount;
+      if (this->header->refCount == 0) deallocate(this->header->allocator, this->header);
       this->_init();
     }
   }
 
+  private: void _appendBuf(T const *buf, LongInt n) {
+    if (n <= 0) return;
+    LongInt length = this->getLength();
+    LongInt newLength = length + n;
+    if (this->header == 0 || this->header->refCount > 1) {
+      T *currentBuf = this->buf;
+      Allocator *allocator = this->header == 0 ? 0 : this->header->allocator;
+      if (this->header != 0) --this->header->refCount;
+      this->_alloc(newLength, allocator);
+      memcpy(this->buf, currentBuf, sizeof(T) * length);
+    } else {
+      this->_grow(newLength);
+    }
+    memcpy(this->buf + length, buf, sizeof(T) * n);
+    this->buf[newLength] = 0;
+    this->header->length = newLength;
+  }
+
   public: LongInt getLength() const {
-    return getLength(this->buf);
+    if (this->header == 0 || this->header->length == -1) return getLength(this->buf);
+    return this->header->length;
   }
 
+  /// The caller is expected to fill the allocated buffer and terminate it. The
+  /// length of the string is then determined by the terminator.
   public: void alloc(LongInt length) {
     this->_release();
     this->_alloc(length);
+    this->buf[0] = 0;
+    this->header->length = -1;
   }
 
   public: void assign(StringBase<T> const &str) {
+    if (this == &str) return;
     this->_release();
-    this->refCount = str.refCount;
+    this->header = str.header;
     this->buf = str.buf;
-    if (this->refCount != 0) {
-      ++*this->refCount;
+    if (this->header != 0) {
+      ++this->header->refCount;
     }
   }
 
   public: void assign(T const *buf) {
     this->_release();
     if (buf != 0) {
-      this->_alloc(getLength(buf));
-      copy(this->buf, buf);
+      this->_appendBuf(buf, getLength(buf));
     }
   }
 
   public: void assign(T const *buf, LongInt n) {
     this->_release();
-    this->_alloc(n);
-    copy(this->buf, buf, n);
-    this->buf[n] = 0;
+    this->_appendBuf(buf, getLength(buf, n));
   }
 
   public: void append(T const *buf) {
-    this->append(buf, getLength(buf));
+    this->_appendBuf(buf, getLength(buf));
   }
 
   public: void append(T const *buf, LongInt n) {
-    auto bufLen = getLength(buf);
-    if (bufLen == 0) return;
-    auto thisBufLen = this->getLength();
-    if (thisBufLen == 0) {
-      this->assign(buf, n);
-      return;
-    }
-    LongInt newLength = thisBufLen + bufLen;
-    if (this->refCount == 0) {
-      T *currentBuf = this->buf;
-      this->_alloc(newLength);
-      copy(this->buf, currentBuf);
-      concat(this->buf, buf, n);
-    } else if (*this->refCount > 1) {
-      T *currentBuf = this->buf;
-      --*this->refCount;
-      this->_alloc(newLength);
-      copy(this->buf, currentBuf);
-      concat(this->buf, buf, n);
-    } else {
-      this->_realloc(newLength);
-      concat(this->buf, buf, n);
-    }
+    this->_appendBuf(buf, getLength(buf, n));
   }
 
   public: void append(T c) {
-    this->append(&c, 1);
+    if (c != 0) this->_appendBuf(&c, 1);
   }
 
   public: void append(LongInt i);
@@ -193,9 +221,9 @@ template<class T> class StringBase
   }
 
   public: LongInt find(LongInt startPos, T const *buf) const {
-    T *startBuf = this->buf;
-    while (*startBuf != 0 && startPos > 0) { --startPos; ++startBuf; }
-    if (startPos > 0) return -1;
+    if (startPos < 0) startPos = 0;
+    if (startPos > this->getLength()) return -1;
+    T *startBuf = this->buf + startPos;
     void const *pos = find(startBuf, buf);
     if (pos == 0) return -1;
     return (ArchInt)pos - (ArchInt)this->buf;
@@ -213,9 +241,9 @@ template<class T> class StringBase
   }
 
   public: LongInt find(LongInt startPos, T c) const {
-    T *startBuf = this->buf;
-    while (*startBuf != 0 && startPos > 0) { --startPos; ++startBuf; }
-    if (startPos > 0) return -1;
+    if (startPos < 0) startPos = 0;
+    if (startPos > this->getLength()) return -1;
+    T *startBuf = this->buf + startPos;
     void const *pos = find(startBuf, c);
     if (pos == 0) return -1;
     return (ArchInt)pos - (ArchInt)this->buf;
@@ -494,6 +522,12 @@ template<class T> class StringBase
 
   public: static LongInt getLength(T const *s);
 
+  public: static LongInt getLength(T const *s, LongInt n) {
+    LongInt length = 0;
+    while (length < n && s[length] != 0) ++length;
+    return length;
+  }
+
   public: static T toUpper(T c);
 
   public: static T toLower(T c);